@@ -87,6 +87,12 @@ void BERCounter::Init()
     bits_ref.resize(k_qam, 0.0);
 }
 
+bool BERCounter::Reconfigure()
+{
+    /* The settings are read at each edge */
+    return true;
+}
+
 void BERCounter::RunClockMaster()
 {
     /* Optimal Phase Estimation */
@@ -114,16 +120,15 @@ void BERCounter::RunClockMaster()
     if (enable && valid_phase)
     {   
         /* Updated Buffer */
-        for (size_t i = 99; i > 0; i--)
-        {
-            r_delay_comp.i[i] = r_delay_comp.o[i - 1];
-        }
-        r_delay_comp.i[0] = i_symb_ref.GetData();
+        r_delay_comp.Push(i_symb_ref.GetData());
+
+        /* Reference delayed by phase symbols */
+        std::complex<double> symb_ref = (phase == 0) ? i_symb_ref.GetData() : r_delay_comp.o[phase - 1];
         
-        if (r_delay_comp.o[phase - 1] != std::complex<double>(0, 0))
+        if (symb_ref != std::complex<double>(0, 0))
         {
             /* Demapper */
-            bits_ref = Demapper(r_delay_comp.o[phase - 1]);
+            bits_ref = Demapper(symb_ref);
             bits_hat = Demapper(i_symb_hat.GetData());
 
             /* Comparision */
@@ -149,6 +154,24 @@ void BERCounter::RunClockMaster()
     }   
 }
 
+void BERCounter::SaveState(std::ostream& stream) const
+{
+    Checkpoint::Write(stream, bits_hat);
+    Checkpoint::Write(stream, bits_ref);
+    Checkpoint::Write(stream, correlation_counter);
+    Checkpoint::Write(stream, symbols_hat);
+    Checkpoint::Write(stream, symbols_ref);
+}
+
+void BERCounter::RestoreState(std::istream& stream)
+{
+    Checkpoint::Read(stream, bits_hat);
+    Checkpoint::Read(stream, bits_ref);
+    Checkpoint::Read(stream, correlation_counter);
+    Checkpoint::Read(stream, symbols_hat);
+    Checkpoint::Read(stream, symbols_ref);
+}
+
 std::vector<bool> BERCounter::Demapper(std::complex<double> symbol)
 {
     std::vector<bool> demod_symb(k_qam);
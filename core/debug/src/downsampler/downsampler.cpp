@@ -71,11 +71,20 @@ void Downsampler::Init()
 {
     /* Registers */
     r_counter.Set(phase);
+    applied_phase = phase;
 
     /* Variables */
     i_n_ovr >> n_ovr;
 }
 
+bool Downsampler::Reconfigure()
+{
+    /* Shift the running counter by the change of phase */
+    r_counter.Set((r_counter.o + phase + n_ovr - applied_phase % n_ovr) % n_ovr);
+    applied_phase = phase;
+    return true;
+}
+
 void Downsampler::RunClockMaster()
 {
     if ((r_counter.o + 1u) == n_ovr)
@@ -53,6 +53,9 @@ private:
     /* Variables */
     size_t n_ovr { 4 };
 
+    /* Phase applied to the counter */
+    size_t applied_phase { 0 };
+
     /* Settings YAML */
     size_t phase { 0 };
 
@@ -62,6 +65,7 @@ public:
 
     /* User methods */
     void Init() override;
+    bool Reconfigure() override;
     void Connect() override;
     void RunClockMaster() override;
     
@@ -76,23 +76,23 @@ Root::Root()
 
 void Root::Connect()
 {    
-    /* Independent Clock */
+    /* Independent Clocks: channel and symbol rate domains */
     clk_ch.i_frequency_hz << fs_ch;
     clk_ch.i_phase_deg.SetData(0);
     clk_ch.i_division_factor_num.SetData(1);
     clk_ch.i_division_factor_den.SetData(1);
 
+    clk_br_rx.i_frequency_hz << fs_br;
+    clk_br_rx.i_phase_deg.SetData(0);
+    clk_br_rx.i_division_factor_num.SetData(1);
+    clk_br_rx.i_division_factor_den.SetData(1);
+
     /* Derived Clocks */
-    clk_br_tx << clk_ch;
+    clk_br_tx << clk_br_rx;
     clk_br_tx.i_phase_deg.SetData(0);
-    clk_br_tx.i_division_factor_num << n_ovr;
+    clk_br_tx.i_division_factor_num.SetData(1);
     clk_br_tx.i_division_factor_den.SetData(1);
 
-    clk_br_rx << clk_ch;
-    clk_br_rx.i_phase_deg.SetData(0);
-    clk_br_rx.i_division_factor_num << n_ovr;
-    clk_br_rx.i_division_factor_den.SetData(1);
-
     /* Command Handler Clock */
     clk_cmd_handler << clk_ch;
     clk_cmd_handler.i_phase_deg.SetData(0);
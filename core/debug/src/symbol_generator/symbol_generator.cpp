@@ -68,8 +68,14 @@ void SymbolGenerator::Init()
     k_qam = static_cast<size_t>(std::round(std::sqrt(m_qam)));
 
     /* Random Generator */
-    uniform_dist = std::uniform_int_distribution<int>(0, static_cast<int>(k_qam - 1UL));
-    rng = std::mt19937(seed);
+    rng.Init(static_cast<uint64_t>(seed), GetFullName());
+}
+
+bool SymbolGenerator::Reconfigure()
+{
+    /* Random Generator */
+    rng.Init(static_cast<uint64_t>(seed), GetFullName());
+    return true;
 }
 
 void SymbolGenerator::Connect()
@@ -86,11 +92,24 @@ void SymbolGenerator::Connect()
 
 void SymbolGenerator::RunClockMaster()
 {
-    int symb_i_aux = 2 * uniform_dist(rng) - static_cast<int>(k_qam - 1UL);
-    int symb_q_aux = 2 * uniform_dist(rng) - static_cast<int>(k_qam - 1UL);
+    uint32_t symbols[2];
+    rng.Integer(i_clock->GetTickCount(), static_cast<uint32_t>(k_qam), symbols, 2);
+
+    int symb_i_aux = 2 * static_cast<int>(symbols[0]) - static_cast<int>(k_qam - 1UL);
+    int symb_q_aux = 2 * static_cast<int>(symbols[1]) - static_cast<int>(k_qam - 1UL);
 
     r_symb_ref.i = std::complex<double>(symb_i_aux, symb_q_aux);
     r_symb_tx.i = std::complex<double>(symb_i_aux, symb_q_aux) * sqrt(p_tx / p_qam);
 
     n_symbols++;
-}
\ No newline at end of file
+}
+
+void SymbolGenerator::SaveState(std::ostream& stream) const
+{
+    Checkpoint::Write(stream, n_symbols);
+}
+
+void SymbolGenerator::RestoreState(std::istream& stream)
+{
+    Checkpoint::Read(stream, n_symbols);
+}
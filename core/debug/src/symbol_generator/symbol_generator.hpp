@@ -39,7 +39,6 @@
 #pragma once
 
 #include <complex>
-#include <random>
 #include <cmath>
 
 #include "halcon.hpp"
@@ -53,8 +52,7 @@ private:
     Register<std::complex<double>> r_symb_ref;
 
     /* Random Generator */
-    std::uniform_int_distribution<int> uniform_dist;
-    std::mt19937 rng;
+    RandomStream rng;
 
     /* Variables */
     double p_qam;
@@ -72,8 +70,11 @@ public:
 
     /* User methods */
     void Init() override;
+    bool Reconfigure() override;
     void Connect() override;
     void RunClockMaster() override;
+    void SaveState(std::ostream& stream) const override;
+    void RestoreState(std::istream& stream) override;
     
     /* Ports */
     Input<Clock> i_clock;
@@ -71,11 +71,20 @@ void Upsampler::Init()
 {
     /* Registers */
     r_counter.i = phase;
+    applied_phase = phase;
 
     /* Variables */
     i_n_ovr >> n_ovr;
 }
 
+bool Upsampler::Reconfigure()
+{
+    /* Shift the running counter by the change of phase */
+    r_counter.Set((r_counter.o + phase + n_ovr - applied_phase % n_ovr) % n_ovr);
+    applied_phase = phase;
+    return true;
+}
+
 void Upsampler::RunClockMaster()
 {
     if ((r_counter.o + 1u) == n_ovr)
@@ -0,0 +1,302 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD LIBRARIES
+********************************************************************************/
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+
+/*******************************************************************************
+* LOCAL LIBRARIES
+********************************************************************************/
+
+#include "clock.hpp"
+#include "command_handler.hpp"
+#include "domain_scheduler.hpp"
+#include "logger.hpp"
+#include "module.hpp"
+#include "port.hpp"
+#include "register.hpp"
+#include "scheduler.hpp"
+#include "setter.hpp"
+
+/*******************************************************************************
+* MACROS
+********************************************************************************/
+
+#define N_STAGES 4
+#define N_TAPS 512
+#define N_SAMPLES 20000UL
+#define WINDOW 64
+
+/*******************************************************************************
+* MODULES
+********************************************************************************/
+
+/**
+ * @brief Pipeline stage: an N_TAPS FIR filter of the previous stage plus
+ * pseudo-random dither. Every stage keeps a checksum of N_SAMPLES outputs.
+ */
+class Stage : public Module
+{
+private:
+
+    Register<unsigned long> r_seed;
+    Register<double, N_TAPS> r_taps;
+    Register<double> r_out;
+    Register<unsigned long> r_count;
+    Register<double> r_checksum;
+    std::array<double, N_TAPS> coeffs;
+
+public:
+
+    Stage()
+    {
+        REFLECT(r_seed);
+        REFLECT(r_taps);
+        REFLECT(r_out);
+        REFLECT(r_count);
+        REFLECT(r_checksum);
+        REFLECT(i_clock);
+        REFLECT(i_signal);
+        REFLECT(o_signal);
+    }
+
+    void Init() override
+    {
+        for (size_t i {0}; i < N_TAPS; i++)
+        {
+            coeffs[i] = 1.0 / static_cast<double>(i + 1);
+        }
+    }
+
+    void Connect() override
+    {
+        i_clock->RegisterOnPositiveEdge(this, r_seed);
+        i_clock->RegisterOnPositiveEdge(this, r_taps);
+        i_clock->RegisterOnPositiveEdge(this, r_out);
+        i_clock->RegisterOnPositiveEdge(this, r_count);
+        i_clock->RegisterOnPositiveEdge(this, r_checksum);
+        o_signal << r_out.o;
+    }
+
+    void RunClockMaster() override
+    {
+        /* Pseudo-random dither on top of the previous stage */
+        r_seed.i = r_seed.o * 6364136223846793005UL + 1442695040888963407UL;
+        double sample = i_signal.GetData() + static_cast<double>(r_seed.o >> 11) / 9007199254740992.0;
+
+        r_taps.i[0] = sample;
+        for (size_t i {1}; i < N_TAPS; i++)
+        {
+            r_taps.i[i] = r_taps.o[i - 1];
+        }
+
+        double acc {0};
+        for (size_t i {0}; i < N_TAPS; i++)
+        {
+            acc += coeffs[i] * r_taps.o[i];
+        }
+        r_out.i = acc;
+
+        /* Checksum of the first N_SAMPLES outputs */
+        r_count.i = r_count.o + 1;
+        r_checksum.i = (r_count.o < N_SAMPLES) ? r_checksum.o * 0.999 + acc : r_checksum.o;
+    }
+
+    unsigned long GetCount() const
+    {
+        return r_count.o;
+    }
+
+    double GetChecksum() const
+    {
+        return r_checksum.o;
+    }
+
+    Input<Clock> i_clock;
+    Input<double> i_signal;
+    Output<double> o_signal;
+};
+
+/**
+ * @brief N_STAGES pipeline stages, each one on its own clock. The clocks
+ * have the same frequency, so every boundary is a pipeline register.
+ */
+class Top : public Module
+{
+public:
+
+    std::array<Clock, N_STAGES> clks;
+    std::array<Stage, N_STAGES> u_stages;
+    Clock clk_ref;
+
+    Top()
+    {
+        REFLECT(clk_ref);
+
+        for (size_t i {0}; i < N_STAGES; i++)
+        {
+            Reflect("clk_" + std::to_string(i), clks[i]);
+            Reflect("u_stage_" + std::to_string(i), u_stages[i]);
+        }
+    }
+
+    void Init() override {}
+
+    void Connect() override
+    {
+        for (size_t i {0}; i < N_STAGES; i++)
+        {
+            clks[i].i_frequency_hz.SetData(1e9L);
+            clks[i].i_phase_deg.SetData(0);
+            clks[i].i_division_factor_num.SetData(1);
+            clks[i].i_division_factor_den.SetData(1);
+
+            u_stages[i].i_clock << clks[i];
+        }
+
+        u_stages[0].i_signal.SetData(0);
+        for (size_t i {1}; i < N_STAGES; i++)
+        {
+            u_stages[i].i_signal << u_stages[i - 1].o_signal;
+        }
+
+        /* Reference clock: the domains meet every WINDOW samples */
+        clk_ref << clks[0];
+        clk_ref.i_phase_deg.SetData(0);
+        clk_ref.i_division_factor_num.SetData(WINDOW);
+        clk_ref.i_division_factor_den.SetData(1);
+    }
+
+    void RunClockMaster() override {}
+
+    bool IsDone() const
+    {
+        return u_stages.back().GetCount() >= N_SAMPLES;
+    }
+};
+
+/*******************************************************************************
+* BENCHMARK
+********************************************************************************/
+
+/**
+ * @brief Runs the pipeline until the last stage has N_SAMPLES outputs.
+ * 
+ * @return ns per sample and checksum
+ */
+std::pair<double, double> Benchmark(bool domains)
+{
+    ClockContext context;
+    auto top = std::make_unique<Top>();
+    YAML::Node settings = YAML::Load("root: {}");
+    top->Initialize(settings);
+
+    CommandHandler cmd_handler;
+    Setter setter;
+    Logger logger;
+    Scheduler scheduler;
+    DomainScheduler domain_scheduler;
+
+    if (domains)
+    {
+        domain_scheduler.Init(*top, top->clk_ref, context.GetClocks(), cmd_handler, setter, logger, false, 1, top->GetCombinationalOrder());
+    }
+    else
+    {
+        scheduler.Init(context.GetClocks(), false, 1, top->GetCombinationalOrder());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (!top->IsDone())
+    {
+        if (domains)
+        {
+            domain_scheduler.RunWindow();
+        }
+        else
+        {
+            scheduler.UpdateNextClocks();
+            scheduler.RunClocks();
+        }
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double, std::nano>(stop - start);
+
+    return {elapsed.count() / static_cast<double>(N_SAMPLES), top->u_stages.back().GetChecksum()};
+}
+
+/*******************************************************************************
+* MAIN
+********************************************************************************/
+
+int main()
+{
+    std::cout << std::setw(10) << "domains"
+              << std::setw(16) << "[ns/sample]"
+              << std::setw(10) << "speedup"
+              << std::setw(26) << "checksum" << std::endl;
+
+    auto [serial_ns, serial_checksum] = Benchmark(false);
+    auto [domain_ns, domain_checksum] = Benchmark(true);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(10) << 1
+              << std::setw(16) << serial_ns
+              << std::setw(10) << 1.0
+              << std::setprecision(12)
+              << std::setw(26) << serial_checksum << std::endl;
+
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(10) << N_STAGES
+              << std::setw(16) << domain_ns
+              << std::setw(10) << serial_ns / domain_ns
+              << std::setprecision(12)
+              << std::setw(26) << domain_checksum
+              << ((domain_checksum == serial_checksum) ? "" : "  MISMATCH") << std::endl;
+}
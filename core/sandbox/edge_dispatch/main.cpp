@@ -0,0 +1,295 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD LIBRARIES
+********************************************************************************/
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL LIBRARIES
+********************************************************************************/
+
+#include "clock.hpp"
+#include "module.hpp"
+#include "port.hpp"
+#include "register.hpp"
+#include "scheduler.hpp"
+
+/*******************************************************************************
+* MACROS
+********************************************************************************/
+
+#define N_MODULES 4096
+#define N_REGISTERS 4
+#define N_EDGES 20000UL
+
+/*******************************************************************************
+* DISPATCH
+********************************************************************************/
+
+/**
+ * @brief Dispatch modes: hash map of modules (first layout), flat register
+ * list with one virtual RunClock() per register, and clock register banks.
+ */
+enum class Dispatch {HASH_MAP, FLAT, BANK};
+
+/**
+ * @brief First edge layout: one hash-map entry and one heap vector of
+ * registers per module.
+ */
+using LegacyEdgeMap = std::unordered_map<Module*, std::vector<AbstractRegister*>>;
+
+/*******************************************************************************
+* MODULES
+********************************************************************************/
+
+/**
+ * @brief Sequential module with N_REGISTERS registers of mixed types and no
+ * logic, so that an edge only costs the dispatch and the register commits.
+ */
+class Cell : public Module
+{
+private:
+
+    Register<unsigned long> r_count;
+    Register<double> r_value;
+    Register<double, 4> r_taps;
+    Register<bool> r_valid;
+
+public:
+
+    Cell()
+    {
+        REFLECT(r_count);
+        REFLECT(r_value);
+        REFLECT(r_taps);
+        REFLECT(r_valid);
+        REFLECT(i_clock);
+    }
+
+    void Init() override {}
+
+    void Connect() override
+    {
+        i_clock->RegisterOnPositiveEdge(this, r_count);
+        i_clock->RegisterOnPositiveEdge(this, r_value);
+        i_clock->RegisterOnPositiveEdge(this, r_taps);
+        i_clock->RegisterOnPositiveEdge(this, r_valid);
+    }
+
+    void RunClockMaster() override {}
+
+    void RegisterOn(LegacyEdgeMap& edge_map)
+    {
+        RegisterOn(edge_map[this]);
+    }
+
+    void RegisterOn(std::vector<AbstractRegister*>& registers)
+    {
+        registers.push_back(&r_count);
+        registers.push_back(&r_value);
+        registers.push_back(&r_taps);
+        registers.push_back(&r_valid);
+    }
+
+    Input<Clock> i_clock;
+};
+
+/**
+ * @brief N_MODULES cells on a single clock.
+ */
+class Top : public Module
+{
+public:
+
+    Clock clk;
+    std::array<Cell, N_MODULES> u_cells;
+
+    Top()
+    {
+        REFLECT(clk);
+
+        for (size_t i {0}; i < N_MODULES; i++)
+        {
+            Reflect("u_cell_" + std::to_string(i), u_cells[i]);
+        }
+    }
+
+    void Init() override {}
+
+    void Connect() override
+    {
+        clk.i_frequency_hz.SetData(1e9L);
+        clk.i_phase_deg.SetData(0);
+        clk.i_division_factor_num.SetData(1);
+        clk.i_division_factor_den.SetData(1);
+
+        for (auto &cell : u_cells)
+        {
+            cell.i_clock << clk;
+        }
+    }
+
+    void RunClockMaster() override {}
+};
+
+/*******************************************************************************
+* BENCHMARK
+********************************************************************************/
+
+/**
+ * @brief Positive edge commit through the legacy hash map.
+ */
+void RunHashMap(LegacyEdgeMap& edge_map)
+{
+    for (auto &[module_ptr, reg_ptrs] : edge_map)
+    {
+        for (auto &reg_ptr : reg_ptrs)
+        {
+            reg_ptr->RunClock();
+        }
+        module_ptr->SetMasterAsNotDone();
+    }
+}
+
+/**
+ * @brief Positive edge commit through a flat list of registers.
+ */
+void RunFlat(std::vector<AbstractRegister*>& registers, std::vector<Module*>& modules)
+{
+    for (auto &reg_ptr : registers)
+    {
+        reg_ptr->RunClock();
+    }
+
+    for (auto &module_ptr : modules)
+    {
+        module_ptr->SetMasterAsNotDone();
+    }
+}
+
+/**
+ * @brief Runs N_EDGES positive edge commits.
+ * 
+ * @return ns per edge
+ */
+double Benchmark(Dispatch dispatch)
+{
+    ClockContext context;
+    auto top = std::make_unique<Top>();
+    YAML::Node settings = YAML::Load("root: {}");
+    top->Initialize(settings);
+
+    Scheduler scheduler;
+    scheduler.Init(context.GetClocks(), false, 1, top->GetCombinationalOrder());
+
+    LegacyEdgeMap edge_map;
+    std::vector<AbstractRegister*> registers;
+    std::vector<Module*> modules;
+
+    for (auto &cell : top->u_cells)
+    {
+        cell.RegisterOn(edge_map);
+        cell.RegisterOn(registers);
+        modules.push_back(&cell);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i {0}; i < N_EDGES; i++)
+    {
+        switch (dispatch)
+        {
+            case Dispatch::HASH_MAP:
+                RunHashMap(edge_map);
+                break;
+
+            case Dispatch::FLAT:
+                RunFlat(registers, modules);
+                break;
+
+            case Dispatch::BANK:
+                /* The clock state is not updated: every call is a positive edge */
+                top->clk.RunClockSlave();
+                break;
+        }
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double, std::nano>(stop - start);
+
+    return elapsed.count() / static_cast<double>(N_EDGES);
+}
+
+/*******************************************************************************
+* MAIN
+********************************************************************************/
+
+int main()
+{
+    std::cout << std::setw(12) << "dispatch"
+              << std::setw(16) << "[ns/edge]"
+              << std::setw(16) << "[ns/register]"
+              << std::setw(10) << "speedup" << std::endl;
+
+    double hash_map_ns = Benchmark(Dispatch::HASH_MAP);
+    double flat_ns = Benchmark(Dispatch::FLAT);
+    double bank_ns = Benchmark(Dispatch::BANK);
+
+    for (auto [name, ns] : {std::pair{"hash map", hash_map_ns},
+                            std::pair{"flat", flat_ns},
+                            std::pair{"bank", bank_ns}})
+    {
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(12) << name
+                  << std::setw(16) << ns
+                  << std::setprecision(3)
+                  << std::setw(16) << ns / (N_MODULES * N_REGISTERS)
+                  << std::setprecision(2)
+                  << std::setw(10) << hash_map_ns / ns << std::endl;
+    }
+}
@@ -0,0 +1,330 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD LIBRARIES
+********************************************************************************/
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL LIBRARIES
+********************************************************************************/
+
+#include "clock.hpp"
+#include "module.hpp"
+#include "port.hpp"
+#include "register.hpp"
+#include "scheduler.hpp"
+
+/*******************************************************************************
+* MACROS
+********************************************************************************/
+
+#define N_LANES 64
+#define N_TAPS 256
+#define N_EDGES 20000UL
+
+/*******************************************************************************
+* MODULES
+********************************************************************************/
+
+/**
+ * @brief Sequential lane: pseudo-random samples through an N_TAPS FIR filter.
+ */
+class Lane : public Module
+{
+private:
+
+    Register<unsigned long> r_seed;
+    Register<double, N_TAPS> r_taps;
+    Register<double> r_out;
+    std::array<double, N_TAPS> coeffs;
+
+public:
+
+    Lane()
+    {
+        REFLECT(r_seed);
+        REFLECT(r_taps);
+        REFLECT(r_out);
+        REFLECT(i_clock);
+        REFLECT(o_signal);
+    }
+
+    void Init() override
+    {
+        for (size_t i {0}; i < N_TAPS; i++)
+        {
+            coeffs[i] = 1.0 / static_cast<double>(i + 1);
+        }
+    }
+
+    void Connect() override
+    {
+        i_clock->RegisterOnPositiveEdge(this, r_seed);
+        i_clock->RegisterOnPositiveEdge(this, r_taps);
+        i_clock->RegisterOnPositiveEdge(this, r_out);
+        o_signal << r_out.o;
+    }
+
+    void RunClockMaster() override
+    {
+        r_seed.i = r_seed.o * 6364136223846793005UL + 1442695040888963407UL;
+
+        r_taps.i[0] = static_cast<double>(r_seed.o >> 11) / 9007199254740992.0;
+        for (size_t i {1}; i < N_TAPS; i++)
+        {
+            r_taps.i[i] = r_taps.o[i - 1];
+        }
+
+        double acc {0};
+        for (size_t i {0}; i < N_TAPS; i++)
+        {
+            acc += coeffs[i] * r_taps.o[i];
+        }
+        r_out.i = acc;
+    }
+
+    void Seed(unsigned long seed)
+    {
+        r_seed.Set(seed);
+    }
+
+    Input<Clock> i_clock;
+    Output<double> o_signal;
+};
+
+/**
+ * @brief Fully combinational sum of all lanes.
+ */
+class Combiner : public Module
+{
+private:
+
+    double sum {0};
+
+public:
+
+    Combiner()
+    {
+        REFLECT(i_lanes);
+        REFLECT(o_sum);
+    }
+
+    void Init() override {}
+
+    void Connect() override
+    {
+        o_sum << sum << COMBINATIONAL_PORT;
+    }
+
+    void RunClockMaster() override
+    {
+        sum = 0;
+        for (size_t i {0}; i < N_LANES; i++)
+        {
+            sum += i_lanes.GetData(i);
+        }
+    }
+
+    Input<double, N_LANES> i_lanes;
+    Output<double> o_sum;
+};
+
+/**
+ * @brief Sequential checksum of the combined signal.
+ */
+class Accumulator : public Module
+{
+private:
+
+    Register<double> r_acc;
+
+public:
+
+    Accumulator()
+    {
+        REFLECT(r_acc);
+        REFLECT(i_clock);
+        REFLECT(i_signal);
+    }
+
+    void Init() override {}
+
+    void Connect() override
+    {
+        i_clock->RegisterOnPositiveEdge(this, r_acc);
+    }
+
+    void RunClockMaster() override
+    {
+        r_acc.i = r_acc.o * 0.999 + i_signal.GetData();
+    }
+
+    double GetChecksum() const
+    {
+        return r_acc.o;
+    }
+
+    Input<Clock> i_clock;
+    Input<double> i_signal;
+};
+
+/**
+ * @brief N_LANES parallel lanes combined into one checksum.
+ */
+class Top : public Module
+{
+public:
+
+    Clock clk;
+    std::array<Lane, N_LANES> u_lanes;
+    Combiner u_combiner;
+    Accumulator u_accumulator;
+
+    Top()
+    {
+        REFLECT(clk);
+        REFLECT(u_combiner);
+        REFLECT(u_accumulator);
+
+        for (size_t i {0}; i < N_LANES; i++)
+        {
+            Reflect("u_lane_" + std::to_string(i), u_lanes[i]);
+        }
+    }
+
+    void Init() override {}
+
+    void Connect() override
+    {
+        clk.i_frequency_hz.SetData(1e9L);
+        clk.i_phase_deg.SetData(0);
+        clk.i_division_factor_num.SetData(1);
+        clk.i_division_factor_den.SetData(1);
+
+        for (size_t i {0}; i < N_LANES; i++)
+        {
+            u_lanes[i].i_clock << clk;
+            u_lanes[i].Seed(i + 1);
+            u_combiner.i_lanes[i] << u_lanes[i].o_signal;
+        }
+
+        u_accumulator.i_clock << clk;
+        u_accumulator.i_signal << u_combiner.o_sum;
+    }
+
+    void RunClockMaster() override {}
+};
+
+/*******************************************************************************
+* BENCHMARK
+********************************************************************************/
+
+/**
+ * @brief Runs N_EDGES edges with n_threads threads.
+ * 
+ * @return ns per edge and checksum
+ */
+std::pair<double, double> Benchmark(size_t n_threads)
+{
+    ClockContext context;
+    auto top = std::make_unique<Top>();
+    YAML::Node settings = YAML::Load("root: {}");
+    top->Initialize(settings);
+
+    Scheduler scheduler;
+    scheduler.Init(context.GetClocks(), false, n_threads, top->GetCombinationalOrder());
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i {0}; i < N_EDGES; i++)
+    {
+        scheduler.UpdateNextClocks();
+        scheduler.RunClocks();
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double, std::nano>(stop - start);
+
+    return {elapsed.count() / static_cast<double>(N_EDGES), top->u_accumulator.GetChecksum()};
+}
+
+/*******************************************************************************
+* MAIN
+********************************************************************************/
+
+int main()
+{
+    size_t max_threads = std::max(4U, std::thread::hardware_concurrency());
+
+    std::cout << std::setw(8) << "threads"
+              << std::setw(16) << "[ns/edge]"
+              << std::setw(10) << "speedup"
+              << std::setw(26) << "checksum" << std::endl;
+
+    double serial_ns {0};
+    double serial_checksum {0};
+
+    for (size_t n_threads {1}; n_threads <= max_threads; n_threads *= 2)
+    {
+        auto [ns, checksum] = Benchmark(n_threads);
+
+        if (n_threads == 1)
+        {
+            serial_ns = ns;
+            serial_checksum = checksum;
+        }
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(8) << n_threads
+                  << std::setw(16) << ns
+                  << std::setw(10) << serial_ns / ns
+                  << std::setprecision(12)
+                  << std::setw(26) << checksum
+                  << ((checksum == serial_checksum) ? "" : "  MISMATCH") << std::endl;
+    }
+}
@@ -0,0 +1,293 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD LIBRARIES
+********************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL LIBRARIES
+********************************************************************************/
+
+#include "clock.hpp"
+#include "scheduler.hpp"
+
+/*******************************************************************************
+* MACROS
+********************************************************************************/
+
+#define N_EDGES 200000UL
+#define BASE_FREQUENCY 1e9L
+
+/*******************************************************************************
+* SORT SCHEDULER (previous implementation, kept as reference)
+********************************************************************************/
+
+class SortScheduler
+{
+private:
+
+    std::vector<Clock*> clocks;
+
+public:
+
+    std::deque<Clock*> next_clocks;
+
+    void Init(std::vector<Clock*> &clock_list)
+    {
+        clocks = clock_list;
+    }
+
+    void RunClocks()
+    {
+        for (Clock* clock : next_clocks)
+        {
+            clock->RunClockMaster();
+        }
+
+        for (Clock* clock : next_clocks)
+        {
+            clock->RunClockSlave();
+            clock->Update();
+        }
+
+        auto sorter = [](Clock* A, Clock* B)
+        {
+            return A->GetNextEdgeTime() < B->GetNextEdgeTime();
+        };
+
+        std::sort(clocks.begin(), clocks.end(), sorter);
+    }
+
+    void UpdateNextClocks()
+    {
+        long double next_edge_time = clocks.front()->GetNextEdgeTime();
+        unsigned int front_count { 0 };
+
+        next_clocks.clear();
+
+        for (Clock* clock : clocks)
+        {
+            if(clock->GetNextEdgeTime() > next_edge_time)
+            {
+                break;
+            }
+
+            switch (clock->GetType())
+            {
+                case 'i':
+                    next_clocks.push_back(clock);
+                    break;
+                case 'd':
+                    next_clocks.push_front(clock);
+                    front_count ++;
+                    break;
+                case 'h':
+                    next_clocks.insert(next_clocks.begin() + front_count, clock);
+                    break;
+            }
+        }
+    }
+};
+
+/*******************************************************************************
+* CLOCK TREE
+********************************************************************************/
+
+/**
+ * @brief Builds n_clocks clocks: one master every four clocks with three
+ * derived clocks (division factors 2/1, 3/2 and 4/1), so the benchmark mixes
+ * independent, dependent and coincident edges. Commensurate masters run at
+ * k * BASE_FREQUENCY / 4, k in 1..5, so the tree has a short hyper-period.
+ */
+std::vector<std::unique_ptr<Clock>> BuildClocks(size_t n_clocks, bool commensurate)
+{
+    std::vector<std::unique_ptr<Clock>> clocks;
+    Clock* master { nullptr };
+
+    for (size_t i {0}; i < n_clocks; i++)
+    {
+        clocks.push_back(std::make_unique<Clock>());
+        Clock &clock = *clocks.back();
+
+        clock.i_phase_deg.SetData(0);
+
+        switch (i % 4)
+        {
+            case 0:
+                master = &clock;
+                if (commensurate)
+                {
+                    clock.i_frequency_hz.SetData(BASE_FREQUENCY * static_cast<long double>(1 + (i / 4) % 5) / 4.0L);
+                }
+                else
+                {
+                    clock.i_frequency_hz.SetData(BASE_FREQUENCY * (1.0L + static_cast<long double>(i) / 997.0L));
+                }
+                clock.i_division_factor_num.SetData(1);
+                clock.i_division_factor_den.SetData(1);
+                break;
+            case 1:
+                clock << *master;
+                clock.i_division_factor_num.SetData(2);
+                clock.i_division_factor_den.SetData(1);
+                break;
+            case 2:
+                clock << *master;
+                clock.i_division_factor_num.SetData(3);
+                clock.i_division_factor_den.SetData(2);
+                break;
+            default:
+                clock << *master;
+                clock.i_division_factor_num.SetData(4);
+                clock.i_division_factor_den.SetData(1);
+                break;
+        }
+    }
+
+    for (auto &clock : clocks)
+    {
+        clock->Init();
+    }
+
+    return clocks;
+}
+
+/*******************************************************************************
+* BENCHMARK
+********************************************************************************/
+
+template <typename S>
+double Benchmark(S &scheduler)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i {0}; i < N_EDGES; i++)
+    {
+        scheduler.UpdateNextClocks();
+        scheduler.RunClocks();
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double, std::nano>(stop - start);
+
+    return elapsed.count() / static_cast<double>(N_EDGES);
+}
+
+double BenchmarkSort(size_t n_clocks)
+{
+    auto clocks = BuildClocks(n_clocks, false);
+
+    std::vector<Clock*> clock_list;
+    for (auto &clock : clocks)
+    {
+        clock_list.push_back(clock.get());
+    }
+
+    SortScheduler scheduler;
+    scheduler.Init(clock_list);
+    return Benchmark(scheduler);
+}
+
+double BenchmarkHeap(size_t n_clocks, bool commensurate, bool replay)
+{
+    auto clocks = BuildClocks(n_clocks, commensurate);
+
+    std::vector<Clock*> clock_list;
+    for (auto &clock : clocks)
+    {
+        clock_list.push_back(clock.get());
+    }
+
+    Scheduler scheduler;
+    scheduler.Init(clock_list, replay, 1, {});
+    return Benchmark(scheduler);
+}
+
+/*******************************************************************************
+* MAIN
+********************************************************************************/
+
+int main()
+{
+    std::vector<size_t> n_clocks_list { 2, 5, 10, 20, 40, 100, 200, 500 };
+
+    std::cout << std::setw(8) << "clocks"
+              << std::setw(16) << "sort [ns/it]"
+              << std::setw(16) << "heap [ns/it]"
+              << std::setw(10) << "speedup" << std::endl;
+
+    for (auto &n_clocks : n_clocks_list)
+    {
+        double sort_ns = BenchmarkSort(n_clocks);
+        double heap_ns = BenchmarkHeap(n_clocks, false, false);
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(8) << n_clocks
+                  << std::setw(16) << sort_ns
+                  << std::setw(16) << heap_ns
+                  << std::setw(10) << sort_ns / heap_ns << std::endl;
+    }
+
+    /* Static clock tree: hyper-period replay */
+    std::cout << std::endl
+              << std::setw(8) << "clocks"
+              << std::setw(16) << "heap [ns/it]"
+              << std::setw(16) << "replay [ns/it]"
+              << std::setw(10) << "speedup" << std::endl;
+
+    for (auto &n_clocks : n_clocks_list)
+    {
+        double heap_ns = BenchmarkHeap(n_clocks, true, false);
+        double replay_ns = BenchmarkHeap(n_clocks, true, true);
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(8) << n_clocks
+                  << std::setw(16) << heap_ns
+                  << std::setw(16) << replay_ns
+                  << std::setw(10) << heap_ns / replay_ns << std::endl;
+    }
+}
@@ -0,0 +1,269 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "checkpoint.hpp"
+
+/*******************************************************************************
+* CHECKPOINT CLASS
+********************************************************************************/
+
+/**
+ * @brief Add an entry
+ * 
+ * @param key Full name of what the entry holds
+ * @param type Type of the bytes
+ * @param data 
+ */
+void Checkpoint::Add(const std::string& key, const std::string& type, std::string data)
+{
+    Entry& entry = entries[key];
+    entry.type = type;
+    entry.data = std::move(data);
+}
+
+/**
+ * @brief Bytes of an entry, which must exist with the same type
+ * 
+ * @param key 
+ * @param type 
+ * @return const std::string& 
+ */
+const std::string& Checkpoint::Get(const std::string& key, const std::string& type)
+{
+    auto it = entries.find(key);
+
+    if (it == entries.end() || it->second.type != type)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [checkpoint mismatch]: "
+                               + "<" + key + "> of type <" + type + "> is not in the checkpoint";
+        throw std::runtime_error(error_text);
+    }
+
+    it->second.is_restored = true;
+    return it->second.data;
+}
+
+/**
+ * @brief Bytes of an entry, which must exist with the same type and size
+ * 
+ * @param key 
+ * @param type 
+ * @param n_bytes 
+ * @return const std::string& 
+ */
+const std::string& Checkpoint::Get(const std::string& key, const std::string& type, size_t n_bytes)
+{
+    const std::string& data = Get(key, type);
+
+    if (data.size() != n_bytes)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [checkpoint mismatch]: "
+                               + "<" + key + "> has " + std::to_string(data.size())
+                               + " bytes in the checkpoint instead of " + std::to_string(n_bytes);
+        throw std::runtime_error(error_text);
+    }
+
+    return data;
+}
+
+/**
+ * @brief Every entry of the checkpoint must have been restored
+ * 
+ */
+void Checkpoint::CheckRestored() const
+{
+    for (const auto& [key, entry] : entries)
+    {
+        if (!entry.is_restored)
+        {
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [checkpoint mismatch]: "
+                                   + "<" + key + "> is not in the model";
+            throw std::runtime_error(error_text);
+        }
+    }
+}
+
+/**
+ * @brief Write the manifest and the entries
+ * 
+ * @param file_name 
+ */
+void Checkpoint::Save(const std::string& file_name) const
+{
+    std::string temporary_name = file_name + ".tmp";
+    std::ofstream file(temporary_name, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + temporary_name;
+        throw std::runtime_error(error_text);
+    }
+
+    file.write(MAGIC, sizeof(MAGIC));
+    Write(file, VERSION);
+    Write(file, static_cast<uint64_t>(entries.size()));
+
+    /* Manifest */
+    for (const auto& [key, entry] : entries)
+    {
+        Write(file, key);
+        Write(file, entry.type);
+        Write(file, static_cast<uint64_t>(entry.data.size()));
+    }
+
+    /* Data */
+    for (const auto& [key, entry] : entries)
+    {
+        file.write(entry.data.data(), static_cast<std::streamsize>(entry.data.size()));
+    }
+
+    file.close();
+
+    if (!file || std::rename(temporary_name.c_str(), file_name.c_str()) != 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be written]: "
+                               + file_name;
+        throw std::runtime_error(error_text);
+    }
+}
+
+/**
+ * @brief Read the manifest and the entries
+ * 
+ * @param file_name 
+ */
+void Checkpoint::Load(const std::string& file_name)
+{
+    std::ifstream file(file_name, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + file_name;
+        throw std::runtime_error(error_text);
+    }
+
+    char magic[sizeof(MAGIC)] {};
+    uint32_t version { 0 };
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+
+    if (!file || !std::equal(magic, magic + sizeof(magic), MAGIC) || version != VERSION)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid checkpoint]: "
+                               + file_name + " is not a version " + std::to_string(VERSION) + " checkpoint";
+        throw std::runtime_error(error_text);
+    }
+
+    /* Manifest */
+    uint64_t n_entries;
+    Read(file, n_entries);
+
+    std::vector<std::pair<std::string, uint64_t>> manifest(n_entries);
+    entries.clear();
+
+    for (auto& [key, n_bytes] : manifest)
+    {
+        Read(file, key);
+        Read(file, entries[key].type);
+        Read(file, n_bytes);
+    }
+
+    /* Data */
+    for (const auto& [key, n_bytes] : manifest)
+    {
+        std::string& data = entries[key].data;
+        data.resize(n_bytes);
+        ReadBytes(file, data.data(), n_bytes);
+    }
+}
+
+void Checkpoint::Write(std::ostream& stream, const std::string& value)
+{
+    Write(stream, static_cast<uint64_t>(value.size()));
+    stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+void Checkpoint::Read(std::istream& stream, std::string& value)
+{
+    uint64_t size;
+    Read(stream, size);
+    value.resize(size);
+    ReadBytes(stream, value.data(), size);
+}
+
+void Checkpoint::ReadBytes(std::istream& stream, char* bytes, size_t n_bytes)
+{
+    if (!stream.read(bytes, static_cast<std::streamsize>(n_bytes)))
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid checkpoint]: "
+                               + "the state ends before its last value";
+        throw std::runtime_error(error_text);
+    }
+}
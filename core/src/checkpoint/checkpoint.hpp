@@ -0,0 +1,153 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*******************************************************************************
+* CHECKPOINT CLASS
+********************************************************************************/
+
+/**
+ * @brief Binary snapshot of a simulation, as named entries of a type and a
+ * block of bytes.
+ *
+ * @details The file starts with a manifest, the key, type and size of every
+ * entry, followed by their bytes. An entry is only restored if the model has
+ * it with the same type and size, so a checkpoint can't be loaded into a
+ * different model. The file is written next to its final name and renamed,
+ * so an interrupted save keeps the previous checkpoint.
+ *
+ * Write() and Read() serialize the state that is not reflected, e.g. the
+ * random engines of a module in its SaveState() and RestoreState().
+ */
+class Checkpoint
+{
+private:
+
+    struct Entry
+    {
+        std::string type;
+        std::string data;
+        bool is_restored { false };
+    };
+
+    std::map<std::string, Entry> entries;
+
+    static constexpr char MAGIC[8] { 'H', 'L', 'C', 'N', 'C', 'K', 'P', 'T' };
+    static constexpr uint32_t VERSION { 1 };
+
+    static void ReadBytes(std::istream& stream, char* bytes, size_t n_bytes);
+
+public:
+
+    /* Entries */
+    void Add(const std::string& key, const std::string& type, std::string data);
+    const std::string& Get(const std::string& key, const std::string& type);
+    const std::string& Get(const std::string& key, const std::string& type, size_t n_bytes);
+    void CheckRestored() const;
+
+    /* File */
+    void Save(const std::string& file_name) const;
+    void Load(const std::string& file_name);
+
+    /* Values of trivially copyable types, strings and vectors */
+    template <typename T>
+    static void Write(std::ostream& stream, const T& value);
+    template <typename T>
+    static void Read(std::istream& stream, T& value);
+    static void Write(std::ostream& stream, const std::string& value);
+    static void Read(std::istream& stream, std::string& value);
+    template <typename T>
+    static void Write(std::ostream& stream, const std::vector<T>& values);
+    template <typename T>
+    static void Read(std::istream& stream, std::vector<T>& values);
+};
+
+template <typename T>
+void Checkpoint::Write(std::ostream& stream, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Checkpoint::Write() needs a trivially copyable type");
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void Checkpoint::Read(std::istream& stream, T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Checkpoint::Read() needs a trivially copyable type");
+    ReadBytes(stream, reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void Checkpoint::Write(std::ostream& stream, const std::vector<T>& values)
+{
+    Write(stream, static_cast<uint64_t>(values.size()));
+
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        T value = values[i];
+        Write(stream, value);
+    }
+}
+
+template <typename T>
+void Checkpoint::Read(std::istream& stream, std::vector<T>& values)
+{
+    uint64_t size;
+    Read(stream, size);
+    values.resize(size);
+
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        T value;
+        Read(stream, value);
+        values[i] = value;
+    }
+}
@@ -36,23 +36,33 @@
 * SOFTWARE.
 ********************************************************************************/
 
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
 
+#include "checkpoint.hpp"
 #include "clock.hpp"
 
 /*******************************************************************************
 * CLOCK CLASS
 ********************************************************************************/
 
-/* Static attribute initialization */
-std::vector<Clock*> Clock::instances;
-
-Clock::Clock()
+Clock::Clock() : context(ClockContext::GetCurrent())
 {
-    /* Save instance pointer */
-    instances.push_back(this);
+    /* Register in the context of the simulator being built */
+    if (context)
+    {
+        context->Add(this);
+    }
 
     /* Variables */
     REFLECT(state);
@@ -71,23 +81,28 @@ Clock::Clock()
 
 Clock::~Clock()
 {
-    auto it = std::find(instances.begin(), instances.end(), this);
-    instances.erase(it);
+    if (context)
+    {
+        context->Remove(this);
+    }
 }
 
 void Clock::Init()
 {
+    /* Edge tables are complete after Connect() */
+    Freeze(posedge_table);
+    Freeze(negedge_table);
+
+    /* Module evaluation order */
+    ElaborateModules();
+
     /* Update period */
-    division_factor_num = static_cast<long double>(i_division_factor_num.GetData());
-    division_factor_den = static_cast<long double>(i_division_factor_den.GetData());
-    division_factor = division_factor_num / division_factor_den;
-    frequency = i_frequency_hz.GetData() / division_factor;
-    full_period = 1 / frequency;
-    half_period = 1 / frequency / 2;
+    phase_deg = i_phase_deg.GetData();
+    UpdatePeriod();
     
     /* Update time */
-    phase_deg = i_phase_deg.GetData();
-    next_edge_time = time.Update(phase_deg / 360.0L * full_period);
+    next_edge_ticks = time.Update(phase_ticks);
+    next_edge_time = TimeAccumulator::ToSeconds(next_edge_ticks);
 
     /* Update derived */
     for (auto &clock : derived_clocks)
@@ -96,18 +111,114 @@ void Clock::Init()
     }
 }
 
+void Clock::UpdatePeriod()
+{
+    long double frequency_hz = i_frequency_hz.GetData();
+    unsigned long factor_num = i_division_factor_num.GetData();
+    unsigned long factor_den = i_division_factor_den.GetData();
+
+    /* Skip: same period */
+    if (!(frequency_hz < input_frequency || frequency_hz > input_frequency)
+        && factor_num == division_factor_num
+        && factor_den == division_factor_den)
+    {
+        return;
+    }
+
+    input_frequency = frequency_hz;
+    division_factor_num = factor_num;
+    division_factor_den = factor_den;
+
+    if (period_changed)
+    {
+        *period_changed = true;
+    }
+
+    /* Frequency in micro hertz */
+    Ticks frequency_uhz = (frequency_hz > 0) ? static_cast<Ticks>(frequency_hz * 1e6L + 0.5L) : 0;
+
+    if (!frequency_uhz || !factor_num || !factor_den)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid clock frequency or division factor]: "
+                               + GetFullName();
+
+        throw std::runtime_error(error_text);
+    }
+
+    frequency = frequency_hz * static_cast<long double>(factor_den)
+              / static_cast<long double>(factor_num);
+
+    /* Exact period in ticks: full_period_num / full_period_den */
+    Ticks full_period_num = TimeAccumulator::TICKS_PER_SECOND * 1000000U * factor_num;
+    Ticks full_period_den = frequency_uhz * factor_den;
+
+    #if !RUN_POSEDGE_LOGIC_ONLY
+        time.SetStep(full_period_num, 2 * full_period_den);
+    #else
+        time.SetStep(full_period_num, full_period_den);
+    #endif
+
+    /* Phase offset in ticks */
+    long double phase = std::fmod(phase_deg, 360.0L);
+    phase = (phase < 0) ? phase + 360.0L : phase;
+    phase_ticks = static_cast<Ticks>(phase / 360.0L
+                                     * static_cast<long double>(full_period_num)
+                                     / static_cast<long double>(full_period_den));
+}
+
 void Clock::RegisterOnPositiveEdge(Module* module_ptr, AbstractRegister& reg_ref)
 {
-    posedge_map[module_ptr].push_back(&reg_ref);
+    Append(posedge_table, module_ptr, reg_ref);
     module_ptr->SetAsSequentialOrMixed();
 }
 
 void Clock::RegisterOnNegativeEdge(Module* module_ptr, AbstractRegister& reg_ref)
 {
-    negedge_map[module_ptr].push_back(&reg_ref);
+    Append(negedge_table, module_ptr, reg_ref);
     module_ptr->SetAsSequentialOrMixed();
 }
 
+void Clock::Append(EdgeTable& table, Module* module_ptr, AbstractRegister& reg_ref)
+{
+    table.registers.push_back(&reg_ref);
+
+    /* Modules usually register all their registers in a row */
+    if (!table.modules.empty() && table.modules.back() == module_ptr)
+    {
+        return;
+    }
+
+    if (std::find(table.modules.begin(), table.modules.end(), module_ptr) == table.modules.end())
+    {
+        table.modules.push_back(module_ptr);
+    }
+}
+
+void Clock::Freeze(EdgeTable& table)
+{
+    table.modules.shrink_to_fit();
+    table.registers.shrink_to_fit();
+
+    table.bank.Clear();
+    for (auto &reg_ptr : table.registers)
+    {
+        table.bank.Add(reg_ptr);
+    }
+    table.bank.Freeze();
+}
+
+void Clock::Commit(EdgeTable& table)
+{
+    table.bank.Commit();
+
+    for (auto &module_ptr : table.modules)
+    {
+        module_ptr->SetMasterAsNotDone();
+    }
+}
+
 void Clock::RegisterDerivedClock(Clock &master_clock)
 {
     ClockLinker::Derivative(&master_clock, this);
@@ -118,24 +229,55 @@ void Clock::operator<<(Clock &master_clock)
     ClockLinker::Derivative(&master_clock, this);
 }
 
-void Clock::RunClockMaster()
+void Clock::ElaborateModules()
 {
-    /* Run modules negative edge */
-    #if RUN_POSEDGE_LOGIC_ONLY == 0
-    for (auto &[module_ptr, reg_ptrs] : negedge_map)
+    master_order.clear();
+
+    auto add = [this](Module* module_ptr)
     {
-        if (module_ptr->IsMasterNotDone())
+        if (std::find(master_order.begin(), master_order.end(), module_ptr) == master_order.end())
         {
-            module_ptr->RunClockMaster();
-            module_ptr->SetMasterAsDone();
+            master_order.push_back(module_ptr);
         }
+    };
+
+    /* Modules negative edge */
+    #if RUN_POSEDGE_LOGIC_ONLY == 0
+    for (auto &module_ptr : negedge_table.modules)
+    {
+        add(module_ptr);
     }
     #endif
 
-    /* Run modules positive edge */
-    for(auto &[module_ptr, reg_ptrs] : posedge_map)
+    /* Modules positive edge */
+    for (auto &module_ptr : posedge_table.modules)
     {
-        if (module_ptr->IsMasterNotDone())
+        add(module_ptr);
+    }
+
+    /* Combinational sources read by them */
+    for (size_t i {0}; i < master_order.size(); i++)
+    {
+        for (Module* source : master_order[i]->GetCombinationalSources())
+        {
+            add(source);
+        }
+    }
+
+    auto by_level = [](Module* a, Module* b)
+    {
+        return a->GetCombinationalLevel() < b->GetCombinationalLevel();
+    };
+
+    std::stable_sort(master_order.begin(), master_order.end(), by_level);
+}
+
+void Clock::RunClockMaster()
+{
+    /* Run modules in combinational level order */
+    for (auto &module_ptr : master_order)
+    {
+        if (module_ptr->IsFullyCombinational() || module_ptr->IsMasterNotDone())
         {
             module_ptr->RunClockMaster();
             module_ptr->SetMasterAsDone();
@@ -149,57 +291,84 @@ void Clock::RunClockSlave()
     #if !RUN_POSEDGE_LOGIC_ONLY
     if (state == HIGH)
     {
-        for (auto& [module_ptr, reg_ptrs] : negedge_map)
-        {
-            for (auto &reg_ptr : reg_ptrs)
-            {
-                reg_ptr->RunClock();
-            }
-            module_ptr->SetMasterAsNotDone();
-        }
+        Commit(negedge_table);
     }
     #endif
 
     /* Run positive edge */
     if (state == LOW)
     {
-        for(auto &[module_ptr, reg_ptrs] : posedge_map)
-        {
-            for(auto &reg_ptr : reg_ptrs)
-            {
-                reg_ptr->RunClock();
-            }
-            module_ptr->SetMasterAsNotDone();
-        }
+        Commit(posedge_table);
     }
 }
 
 void Clock::Update()
 {
     /* Update period */
-    division_factor_num = static_cast<long double>(i_division_factor_num.GetData());
-    division_factor_den = static_cast<long double>(i_division_factor_den.GetData());
-    division_factor = division_factor_num / division_factor_den;
-    frequency = i_frequency_hz.GetData() / division_factor;
-    full_period = 1 / frequency;
-    half_period = 1 / frequency / 2;
+    UpdatePeriod();
 
     /* Update time and edge */
     n_edges++;
     n_ticks += (state == LOW)? 1 : 0;
+    last_edge_ticks = next_edge_ticks;
     last_edge_time = next_edge_time;
 
     #if !RUN_POSEDGE_LOGIC_ONLY
         state = !state;
-        next_edge_time = time.Update(half_period);
+        next_edge_ticks = time.Update();
         next_edge_type = (state == LOW) ? POSITIVE : NEGATIVE;
     #else
-        next_edge_time = time.Update(full_period);
+        next_edge_ticks = time.Update();
     #endif
 
+    next_edge_time = TimeAccumulator::ToSeconds(next_edge_ticks);
+
     /* Update derived clocks */
     for (auto &clock : derived_clocks)
     {
         ClockLinker::Synchronize(this, clock);
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Saves the time, the period and the next edge
+ * 
+ * @param stream 
+ */
+void Clock::SaveState(std::ostream& stream) const
+{
+    Checkpoint::Write(stream, state);
+    Checkpoint::Write(stream, next_edge_type);
+    Checkpoint::Write(stream, time);
+    Checkpoint::Write(stream, phase_deg);
+    Checkpoint::Write(stream, frequency);
+    Checkpoint::Write(stream, input_frequency);
+    Checkpoint::Write(stream, division_factor_num);
+    Checkpoint::Write(stream, division_factor_den);
+    Checkpoint::Write(stream, phase_ticks);
+    Checkpoint::Write(stream, last_edge_ticks);
+    Checkpoint::Write(stream, next_edge_ticks);
+    Checkpoint::Write(stream, last_edge_time);
+    Checkpoint::Write(stream, next_edge_time);
+    Checkpoint::Write(stream, n_ticks);
+    Checkpoint::Write(stream, n_edges);
+}
+
+void Clock::RestoreState(std::istream& stream)
+{
+    Checkpoint::Read(stream, state);
+    Checkpoint::Read(stream, next_edge_type);
+    Checkpoint::Read(stream, time);
+    Checkpoint::Read(stream, phase_deg);
+    Checkpoint::Read(stream, frequency);
+    Checkpoint::Read(stream, input_frequency);
+    Checkpoint::Read(stream, division_factor_num);
+    Checkpoint::Read(stream, division_factor_den);
+    Checkpoint::Read(stream, phase_ticks);
+    Checkpoint::Read(stream, last_edge_ticks);
+    Checkpoint::Read(stream, next_edge_ticks);
+    Checkpoint::Read(stream, last_edge_time);
+    Checkpoint::Read(stream, next_edge_time);
+    Checkpoint::Read(stream, n_ticks);
+    Checkpoint::Read(stream, n_edges);
+}
@@ -42,7 +42,8 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
-#include <unordered_map>
+#include <cstddef>
+#include <iosfwd>
 #include <vector>
 
 /*******************************************************************************
@@ -51,9 +52,11 @@
 
 #include "abstract_clock.hpp"
 #include "abstract_register.hpp"
+#include "clock_context.hpp"
 #include "clock_linker.hpp"
 #include "module.hpp"
 #include "port.hpp"
+#include "register_bank.hpp"
 #include "time_accumulator.hpp"
 
 /*******************************************************************************
@@ -65,7 +68,16 @@ class Clock : public AbstractClock
 private:
 
     friend class Scheduler;
-    static std::vector<Clock*> instances;
+    friend class DomainScheduler;
+
+    /* Context the clock registered in */
+    ClockContext* context { nullptr };
+
+    /* Position in the scheduler event queue */
+    size_t scheduler_index { 0 };
+
+    /* Scheduler flag raised when the period changes at runtime */
+    bool* period_changed { nullptr };
 
 public:
 
@@ -73,6 +85,8 @@ public:
     enum EdgeType{NEGATIVE = 'n', POSITIVE = 'p'};
     enum Type{INDEPENDENT = 'i', DEPENDENT = 'd', HYBRID = 'h'};
 
+    using Ticks = TimeAccumulator::Ticks;
+
 protected:
 
     /* State and Edge */
@@ -82,12 +96,13 @@ protected:
     /* Time and Frequency */
     TimeAccumulator time;
     long double phase_deg { 0 };
-    long double frequency { 1 };
-    long double division_factor_num { 1 };
-    long double division_factor_den { 1 };
-    long double division_factor { 1 };
-    long double full_period { 1 };
-    long double half_period { 0.5 };
+    long double frequency { 0 };
+    long double input_frequency { 0 };
+    unsigned long division_factor_num { 0 };
+    unsigned long division_factor_den { 0 };
+    Ticks phase_ticks { 0 };
+    Ticks last_edge_ticks { 0 };
+    Ticks next_edge_ticks { 0 };
     long double last_edge_time { 0 };
     long double next_edge_time { 0 };
     unsigned long long n_ticks { 0 };
@@ -98,13 +113,29 @@ protected:
     std::vector<Clock*> derived_clocks;
     friend class ClockLinker;
     
-    /* Modules and registers */
-    using RegistersVector = std::vector<AbstractRegister*>;
-    using ModulePointer = Module*;
-    using EdgeMap = std::unordered_map<ModulePointer, RegistersVector>;
-    
-    EdgeMap posedge_map;
-    EdgeMap negedge_map;
+    /* Modules and registers, in registration order, and their commit bank */
+    struct EdgeTable
+    {
+        std::vector<Module*> modules;
+        std::vector<AbstractRegister*> registers;
+        RegisterBank bank;
+
+        /* Fully combinational modules reading the registers, in level order */
+        std::vector<Module*> settle;
+    };
+
+    EdgeTable posedge_table;
+    EdgeTable negedge_table;
+    static void Append(EdgeTable& table, Module* module_ptr, AbstractRegister& reg_ref);
+    static void Freeze(EdgeTable& table);
+    static void Commit(EdgeTable& table);
+
+    /* Registered modules and their combinational sources, in level order */
+    std::vector<Module*> master_order;
+    void ElaborateModules();
+
+    /* Period */
+    void UpdatePeriod();
 
 public:
 
@@ -119,6 +150,9 @@ public:
     inline const char& GetNextEdgeType() const;
     inline const long double& GetNextEdgeTime() const;
     inline const long double& GetLastEdgeTime() const;
+    inline const Ticks& GetNextEdgeTicks() const;
+    inline const Ticks& GetLastEdgeTicks() const;
+    inline const long double& GetFrequency() const;
     inline const unsigned long long& GetTickCount() const;
     inline const unsigned long long& GetEdgeCount() const;
     
@@ -128,6 +162,10 @@ public:
     void RunClockSlave() override;
     void Update();
 
+    /* Time and edge state, for checkpoints */
+    void SaveState(std::ostream& stream) const;
+    void RestoreState(std::istream& stream);
+
     /* Modules */
     void RegisterOnPositiveEdge(Module* module_ptr, AbstractRegister& reg_ref) override;
     void RegisterOnNegativeEdge(Module* module_ptr, AbstractRegister& reg_ref) override;
@@ -178,6 +216,21 @@ inline const long double& Clock::GetLastEdgeTime() const
     return last_edge_time;
 }
 
+inline const Clock::Ticks& Clock::GetNextEdgeTicks() const
+{
+    return next_edge_ticks;
+}
+
+inline const Clock::Ticks& Clock::GetLastEdgeTicks() const
+{
+    return last_edge_ticks;
+}
+
+inline const long double& Clock::GetFrequency() const
+{
+    return frequency;
+}
+
 inline const unsigned long long& Clock::GetTickCount() const
 {
     return n_ticks;
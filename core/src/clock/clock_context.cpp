@@ -0,0 +1,105 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "clock_context.hpp"
+
+/*******************************************************************************
+* CLOCK CONTEXT CLASS
+********************************************************************************/
+
+/* Static attribute initialization */
+thread_local ClockContext* ClockContext::current { nullptr };
+
+ClockContext::ClockContext()
+{
+    current = this;
+}
+
+ClockContext::~ClockContext()
+{
+    if (current == this)
+    {
+        current = nullptr;
+    }
+}
+
+/**
+ * @brief Current context of the calling thread, nullptr if there is none.
+ * 
+ * @return ClockContext* 
+ */
+ClockContext* ClockContext::GetCurrent()
+{
+    return current;
+}
+
+void ClockContext::Add(Clock* clock)
+{
+    clocks.push_back(clock);
+}
+
+/**
+ * @brief Clocks are destroyed in reverse order, so the search starts at the
+ * end.
+ * 
+ * @param clock 
+ */
+void ClockContext::Remove(Clock* clock)
+{
+    auto it = std::find(clocks.rbegin(), clocks.rend(), clock);
+    if (it != clocks.rend())
+    {
+        clocks.erase(std::next(it).base());
+    }
+}
+
+const std::vector<Clock*>& ClockContext::GetClocks() const
+{
+    return clocks;
+}
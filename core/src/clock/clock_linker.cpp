@@ -79,14 +79,13 @@ void ClockLinker::Synchronize(Clock* master, Clock* derived)
         return;
     }
     
-    /* Copy master clock state */
-    derived->time = master->time;
-    derived->full_period = master->full_period * derived->division_factor;
-    derived->half_period = master->half_period * derived->division_factor;   
+    /* Copy master clock time */
+    derived->UpdatePeriod();
+    derived->time.Align(master->time);
 
     /* Update derived clock */
-    long double delta = derived->phase_deg / 360.0L * derived->full_period;
-    derived->next_edge_time = derived->time.Update(delta);
+    derived->next_edge_ticks = derived->time.Update(derived->phase_ticks);
+    derived->next_edge_time = TimeAccumulator::ToSeconds(derived->next_edge_ticks);
 
     /* Update derived */
     for (auto &clock : derived->derived_clocks)
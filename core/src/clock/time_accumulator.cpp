@@ -36,12 +36,6 @@
 * SOFTWARE.
 ********************************************************************************/
 
-/*******************************************************************************
-* STANDARD HEADERS
-********************************************************************************/
-
-#include <cmath>
-
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
@@ -52,30 +46,35 @@
 * TIME ACCUMULATOR CLASS
 ********************************************************************************/
 
-long double TimeAccumulator::Update(long double delta)
+/**
+ * @brief Set the step as the exact fraction numerator / denominator ticks.
+ * 
+ * @param numerator 
+ * @param denominator Must be greater than zero.
+ */
+void TimeAccumulator::SetStep(Ticks numerator, Ticks denominator)
 {
-    volatile long double t = sum + delta;
-    if (std::abs(sum) >= std::abs(delta))
-    {
-        c = (sum - t) + delta;
-    }
-    else
-    {
-        c = (delta - t) + sum;
-    }
-    
-    sum = t;
-    t = cs + c;
-    if (std::abs(cs) >= std::abs(c))
-    {
-        cc = (cs - t) + c;
-    }
-    else
+    step_quotient = numerator / denominator;
+    step_remainder = numerator % denominator;
+
+    /* Keep the current fraction of tick in the new divisor */
+    if (remainder)
     {
-        cc = (c - t) + cs;
+        long double fraction = static_cast<long double>(remainder)
+                             / static_cast<long double>(step_divisor);
+        remainder = static_cast<Ticks>(fraction * static_cast<long double>(denominator));
     }
-    
-    cs = t;
-    ccs = ccs + cc;
-    return sum + cs + ccs;
-}
\ No newline at end of file
+
+    step_divisor = denominator;
+}
+
+/**
+ * @brief Convert ticks to seconds.
+ * 
+ * @param value Ticks.
+ * @return long double 
+ */
+long double TimeAccumulator::ToSeconds(Ticks value)
+{
+    return static_cast<long double>(value) / static_cast<long double>(TICKS_PER_SECOND);
+}
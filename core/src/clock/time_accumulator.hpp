@@ -42,17 +42,103 @@
 * TIME ACCUMULATOR CLASS
 ********************************************************************************/
 
+/**
+ * @brief Exact simulation time.
+ * 
+ * Time is an integer number of ticks of a global base resolution. The step
+ * (a clock period) is kept as the exact rational quotient + remainder/divisor,
+ * so accumulating it never drifts: the error is always below one tick.
+ */
 class TimeAccumulator
 {
+public:
+
+    /* Ticks of the global base resolution */
+    __extension__ typedef unsigned __int128 Ticks;
+
+    /* Base resolution: 1 attosecond */
+    static constexpr Ticks TICKS_PER_SECOND { 1000000000000000000ULL };
+
 private:
 
-    /* Kahan Babushka Klein Algorithm */
-    volatile long double sum { 0.0 };
-    volatile long double cs { 0.0 };
-    volatile long double ccs { 0.0 };
-    volatile long double c { 0.0 };
-    volatile long double cc { 0.0 };
+    /* Current time: ticks + remainder / step_divisor */
+    Ticks ticks { 0 };
+    Ticks remainder { 0 };
+
+    /* Step: step_quotient + step_remainder / step_divisor */
+    Ticks step_quotient { 0 };
+    Ticks step_remainder { 0 };
+    Ticks step_divisor { 1 };
 
 public:
-    long double Update(long double delta);
-};
\ No newline at end of file
+
+    void SetStep(Ticks numerator, Ticks denominator);
+    inline void GetStep(Ticks& numerator, Ticks& denominator) const;
+    inline const Ticks& Update();
+    inline const Ticks& Update(Ticks delta);
+    inline void Align(const TimeAccumulator& master);
+    inline const Ticks& GetTicks() const;
+
+    static long double ToSeconds(Ticks value);
+};
+
+/**
+ * @brief Advance one step.
+ * 
+ * @return Current time in ticks.
+ */
+inline const TimeAccumulator::Ticks& TimeAccumulator::Update()
+{
+    ticks += step_quotient;
+    remainder += step_remainder;
+
+    if (remainder >= step_divisor)
+    {
+        remainder -= step_divisor;
+        ticks++;
+    }
+
+    return ticks;
+}
+
+/**
+ * @brief Advance an integer number of ticks.
+ * 
+ * @param delta Ticks.
+ * @return Current time in ticks.
+ */
+inline const TimeAccumulator::Ticks& TimeAccumulator::Update(Ticks delta)
+{
+    ticks += delta;
+    return ticks;
+}
+
+/**
+ * @brief Move to the time of a master accumulator, keeping the own step.
+ * 
+ * The fraction of tick of the master is dropped, so both times are equal.
+ * 
+ * @param master 
+ */
+inline void TimeAccumulator::Align(const TimeAccumulator& master)
+{
+    ticks = master.ticks;
+    remainder = 0;
+}
+
+/**
+ * @brief Get the step as the exact fraction numerator / denominator ticks.
+ * 
+ * @param numerator 
+ * @param denominator 
+ */
+inline void TimeAccumulator::GetStep(Ticks& numerator, Ticks& denominator) const
+{
+    numerator = step_quotient * step_divisor + step_remainder;
+    denominator = step_divisor;
+}
+
+inline const TimeAccumulator::Ticks& TimeAccumulator::GetTicks() const
+{
+    return ticks;
+}
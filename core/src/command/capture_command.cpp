@@ -0,0 +1,382 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "capture_command.hpp"
+
+/*******************************************************************************
+* CAPTURE COMMAND CLASS
+********************************************************************************/
+
+CaptureCommand::CaptureCommand(std::string command)
+{
+    /* Required options */
+    CommandParser parser("CAPTURE");
+    parser.AddOption("-s,--SIGNAL", signal, "Signal name").Required();
+    parser.AddOption("-c,--CLOCK", clock, "Clock name").Required();
+    parser.AddOption("-g,--TRIGGER", trigger, "Trigger signal name").Required();
+
+    /* Optative options */
+    parser.AddOption("-e,--EDGE", edge, "Clock edge");
+    parser.AddOption("-b,--BEGIN", begin, "First reference clock tick");
+    parser.AddOption("-p,--STEP", step, "Clock tick step");
+    parser.AddOption("-d,--END", end, "Last reference clock tick");
+    parser.AddOption("-i,--INDEX", index, "Value of the trigger signal: array element, real or imaginary part");
+    parser.AddOption("-m,--MODE", mode, "Trigger mode");
+    parser.AddOption("-l,--LEVEL", level, "Trigger level");
+    parser.AddOption("-r,--PRE", pre, "Samples before the trigger");
+    parser.AddOption("-o,--POST", post, "Samples from the trigger on");
+    parser.AddOption("-x,--WINDOWS", max_windows, "Maximum number of windows, 0 for no limit");
+    parser.AddOption("-n,--FILENAMETYPE", file_name_type, "File name type");
+
+    Parse(command, parser);
+}
+
+void CaptureCommand::Init(AbstractHandlerPtr p_signal, AbstractHandlerPtr p_trigger)
+{
+    signal_ptr = p_signal;
+    trigger_ptr = p_trigger;
+
+    /* Unsupported edge */
+    if (RUN_POSEDGE_LOGIC_ONLY && edge != EdgeType::POSITIVE)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [unsupported edge]: "
+                               + "in command <" + command_string 
+                               + "> the sampling edge is negedge but "
+                               + "RUN_POSEDGE_LOGIC_ONLY is ON.";
+        
+        throw std::runtime_error(error_text);
+    }
+
+    /* Full CAPTURE */
+    if (begin >= end && end == 0)
+    {
+        end = std::numeric_limits<size_t>::max();
+    }
+
+    /* BEGIN before END */
+    if (begin > end)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command error]: "
+                               + "in command <" + command_string
+                               + "> begin tick <" + std::to_string(begin)
+                               + "> is grater than end tick <"
+                               + std::to_string(end) + ">.";
+
+        throw std::runtime_error(error_text);
+    }
+
+    /* Unsupported trigger mode */
+    if (mode != Mode::RISING && mode != Mode::FALLING && mode != Mode::CROSSING
+        && mode != Mode::CHANGE && mode != Mode::HIGH && mode != Mode::LOW)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command error]: "
+                               + "in command <" + command_string
+                               + "> trigger mode <" + std::string(1, mode)
+                               + "> is not supported, use r, f, x, c, h or l.";
+
+        throw std::runtime_error(error_text);
+    }
+
+    /* Trigger value out of range */
+    if (index >= trigger_ptr->GetValueCount())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command error]: "
+                               + "in command <" + command_string
+                               + "> trigger index <" + std::to_string(index)
+                               + "> is out of range, " + trigger
+                               + " has " + std::to_string(trigger_ptr->GetValueCount())
+                               + " values.";
+
+        throw std::runtime_error(error_text);
+    }
+
+    /* The trigger sample is the first one after it */
+    if (post == 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command error]: "
+                               + "in command <" + command_string
+                               + "> post trigger samples must be at least 1.";
+
+        throw std::runtime_error(error_text);
+    }
+
+    /* Ring buffer: pre trigger samples and the current one */
+    sample_bytes = signal_ptr->GetSampleBytes();
+    ring_size = pre + 1;
+    ring.assign(ring_size * sample_bytes, 0);
+    ring_ticks.assign(ring_size, 0);
+    trigger_values.resize(trigger_ptr->GetValueCount());
+
+    /* File names */
+    if (file_name_type == FileNameType::LONG)
+    {
+        file_name = "CAPTURE_SIGNAL_" + signal
+                  + "_CLOCK_" + clock
+                  + "_TRIGGER_" + trigger
+                  + "_TYPE_" + signal_ptr->GetTypeAsString()
+                  + "_BYTES_" + signal_ptr->GetNBytesAsString()
+                  + "_SIZE_" + signal_ptr->GetSizeAsString();
+    }
+    else
+    {
+        file_name = signal + ".capture";
+    }
+
+    index_name = file_name + ".yaml";
+    file_name += ".bin";
+}
+
+void CaptureCommand::Run(const std::string& output_path, unsigned long long tick)
+{
+    /* All the windows were captured */
+    if (remaining == 0 && max_windows != 0 && n_windows >= max_windows)
+    {
+        return;
+    }
+
+    if (!file)
+    {
+        Open(output_path);
+    }
+
+    /* Current sample in the ring buffer */
+    char* sample = ring.data() + ring_index * sample_bytes;
+    signal_ptr->CopySample(sample);
+    ring_ticks[ring_index] = tick;
+    ring_index = (ring_index + 1 == ring_size) ? 0 : ring_index + 1;
+    ring_count = std::min(ring_count + 1, ring_size);
+
+    /* Trigger condition, evaluated while capturing to keep the previous value */
+    trigger_ptr->GetValues(trigger_values.data());
+    double value = trigger_values[index];
+    bool is_triggered = IsTriggered(value);
+    previous = value;
+    has_previous = true;
+
+    if (remaining != 0)
+    {
+        file->write(sample, static_cast<std::streamsize>(sample_bytes));
+        window.n_samples++;
+        n_written++;
+
+        if (--remaining == 0)
+        {
+            WriteWindow();
+        }
+    }
+    else if (is_triggered)
+    {
+        Trigger(tick);
+    }
+
+    counter++;
+}
+
+/**
+ * @brief Checks the trigger condition. Edge modes need a previous value.
+ * 
+ * @param value Current value of the trigger signal
+ * @return true 
+ * @return false 
+ */
+bool CaptureCommand::IsTriggered(double value)
+{
+    switch (mode)
+    {
+        case Mode::RISING:
+            return has_previous && previous < level && value >= level;
+
+        case Mode::FALLING:
+            return has_previous && previous >= level && value < level;
+
+        case Mode::CROSSING:
+            return has_previous && ((previous < level) != (value < level));
+
+        case Mode::CHANGE:
+            return has_previous && (value < previous || value > previous);
+
+        case Mode::HIGH:
+            return value >= level;
+
+        case Mode::LOW:
+            return value < level;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Starts a window: writes the samples of the ring buffer, oldest
+ * first, the trigger sample being the last one
+ * 
+ * @param tick Reference clock tick of the trigger
+ */
+void CaptureCommand::Trigger(unsigned long long tick)
+{
+    size_t first = (ring_index + ring_size - ring_count) % ring_size;
+    size_t n_first = std::min(ring_count, ring_size - first);
+
+    file->write(ring.data() + first * sample_bytes, static_cast<std::streamsize>(n_first * sample_bytes));
+    file->write(ring.data(), static_cast<std::streamsize>((ring_count - n_first) * sample_bytes));
+
+    window.trigger_tick = tick;
+    window.trigger_sample = counter;
+    window.first_tick = ring_ticks[first];
+    window.first_sample = counter + 1 - ring_count;
+    window.offset = n_written;
+    window.n_samples = ring_count;
+
+    n_written += ring_count;
+    n_windows++;
+    remaining = post - 1;
+
+    if (remaining == 0)
+    {
+        WriteWindow();
+    }
+}
+
+/**
+ * @brief Creates the data file and the index file with the description of
+ * the command
+ * 
+ * @param output_path 
+ */
+void CaptureCommand::Open(const std::string& output_path)
+{
+    file = std::make_shared<std::ofstream>(output_path + file_name, std::ios::binary);
+    index_file = std::make_shared<std::ofstream>(output_path + index_name);
+
+    if (!file->is_open() || !index_file->is_open())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + output_path + (file->is_open() ? index_name : file_name);
+
+        throw std::runtime_error(error_text);
+    }
+
+    char digits[32];
+    char* last = std::to_chars(digits, digits + sizeof(digits), level).ptr;
+    size_t max_value = std::numeric_limits<size_t>::max();
+
+    *index_file << "signal: " << signal << "\n"
+                << "clock: " << clock << "\n"
+                << "type: " << signal_ptr->GetTypeAsString() << "\n"
+                << "bytes: " << signal_ptr->GetNBytesAsString() << "\n"
+                << "size: " << signal_ptr->GetSizeAsString() << "\n"
+                << "edge: " << edge << "\n"
+                << "begin: " << begin << "\n"
+                << "end: " << ((end == max_value) ? "last" : std::to_string(end)) << "\n"
+                << "step: " << step << "\n"
+                << "trigger: " << trigger << "\n"
+                << "index: " << index << "\n"
+                << "mode: " << mode << "\n"
+                << "level: " << std::string(digits, last) << "\n"
+                << "pre: " << pre << "\n"
+                << "post: " << post << "\n"
+                << "data: " << file_name << "\n";
+}
+
+/**
+ * @brief Adds the current window to the index file
+ * 
+ */
+void CaptureCommand::WriteWindow()
+{
+    if (n_windows == 1)
+    {
+        *index_file << "windows:\n";
+    }
+
+    *index_file << "  - trigger_tick: " << window.trigger_tick << "\n"
+                << "    trigger_sample: " << window.trigger_sample << "\n"
+                << "    first_tick: " << window.first_tick << "\n"
+                << "    first_sample: " << window.first_sample << "\n"
+                << "    offset: " << window.offset << "\n"
+                << "    samples: " << window.n_samples << "\n";
+    index_file->flush();
+}
+
+void CaptureCommand::Terminate(const std::string& output_path)
+{
+    if (!file)
+    {
+        Open(output_path);
+    }
+
+    /* Window cut by the end of the simulation */
+    if (remaining != 0)
+    {
+        remaining = 0;
+        WriteWindow();
+    }
+
+    if (n_windows == 0)
+    {
+        *index_file << "windows: []\n";
+    }
+
+    file->close();
+    index_file->close();
+}
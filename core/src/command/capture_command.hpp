@@ -0,0 +1,156 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "abstract_handler.hpp"
+#include "command.hpp"
+
+/*******************************************************************************
+* MACROS
+********************************************************************************/
+
+#define RUN_POSEDGE_LOGIC_ONLY _RUN_POSEDGE_LOGIC_ONLY
+
+/*******************************************************************************
+* CAPTURE COMMAND CLASS
+********************************************************************************/
+
+/**
+ * @brief Logic analyzer style log. The signal is sampled like a LOG, but
+ * only the last samples are kept in a ring buffer. When a condition on the
+ * trigger signal holds, the samples before the trigger and the ones after it
+ * are written as a window, up to a maximum number of windows. The windows are
+ * appended to a binary file and described, with their trigger tick, in a yaml
+ * index file.
+ */
+class CaptureCommand : public Command
+{
+private:
+
+    /* Signals */
+    using AbstractHandlerPtr = std::shared_ptr<AbstractHandler>;
+    AbstractHandlerPtr signal_ptr;
+    AbstractHandlerPtr trigger_ptr;
+
+    /* Captured window */
+    struct Window
+    {
+        unsigned long long trigger_tick { 0 };
+        uint64_t trigger_sample { 0 };
+        unsigned long long first_tick { 0 };
+        uint64_t first_sample { 0 };
+        uint64_t offset { 0 };
+        uint64_t n_samples { 0 };
+    };
+
+    /* Last samples, the current one included, and their ticks */
+    size_t sample_bytes { 0 };
+    std::vector<char> ring;
+    std::vector<unsigned long long> ring_ticks;
+    size_t ring_size { 0 };
+    size_t ring_index { 0 };
+    size_t ring_count { 0 };
+
+    /* Trigger signal */
+    std::vector<double> trigger_values;
+    double previous { 0.0 };
+    bool has_previous { false };
+
+    /* Capture state */
+    uint64_t counter { 0 };
+    uint64_t n_written { 0 };
+    size_t n_windows { 0 };
+    size_t remaining { 0 };
+    Window window;
+
+    /* Output files */
+    std::string file_name;
+    std::string index_name;
+    std::shared_ptr<std::ofstream> file;
+    std::shared_ptr<std::ofstream> index_file;
+
+    bool IsTriggered(double value);
+    void Open(const std::string& output_path);
+    void Trigger(unsigned long long tick);
+    void WriteWindow();
+
+public:
+
+    /* Options */
+    enum FileNameType {SHORT = 's', LONG = 'l'};
+    enum EdgeType {NEGATIVE = 'n', POSITIVE = 'p', BOTH = 'b'};
+    enum Mode {RISING = 'r', FALLING = 'f', CROSSING = 'x', CHANGE = 'c', HIGH = 'h', LOW = 'l'};
+
+    /* Command fields */
+    std::string signal;
+    std::string clock;
+    char edge { EdgeType::POSITIVE };
+    size_t begin { 0 };
+    size_t step { 1 };
+    size_t end { 0 };
+    std::string trigger;
+    size_t index { 0 };
+    char mode { Mode::RISING };
+    double level { 0.5 };
+    size_t pre { 1000 };
+    size_t post { 1000 };
+    size_t max_windows { 1 };
+    char file_name_type { FileNameType::LONG };
+
+    /* Command methods */
+    CaptureCommand(std::string command);
+    void Init(AbstractHandlerPtr p_signal, AbstractHandlerPtr p_trigger);
+    void Run(const std::string& output_path, unsigned long long tick);
+    void Terminate(const std::string& output_path);
+};
@@ -36,6 +36,12 @@
 * SOFTWARE.
 ********************************************************************************/
 
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <stdexcept>
+
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
@@ -49,9 +55,10 @@
 /**
  * @brief Command initialization based on command_string line
  *
- * @return bool
+ * @param command Command line
+ * @param parser Options of the command
  */
-void Command::Parse(const std::string& command)
+void Command::Parse(const std::string& command, CommandParser& parser)
 {
     /* Save command */
     command_string = command;
@@ -62,7 +69,7 @@ void Command::Parse(const std::string& command)
     /* Try to parse command */
     try
     {
-        app->parse(command_string);
+        parser.Parse(command_string);
     }
     catch(const std::exception& e)
     {
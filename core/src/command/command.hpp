@@ -48,7 +48,7 @@
 * LOCAL HEADERS
 ********************************************************************************/
 
-#include "CLI11.hpp"
+#include "command_parser.hpp"
 
 /*******************************************************************************
 * COMMAND CLASS
@@ -61,7 +61,6 @@
 class Command
 {
 protected:
-    CLI::App *app = new CLI::App("");
     std::string command_string;
-    void Parse(const std::string& command);
+    void Parse(const std::string& command, CommandParser& parser);
 };
\ No newline at end of file
@@ -0,0 +1,311 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <charconv>
+#include <stdexcept>
+#include <type_traits>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "command_parser.hpp"
+
+/*******************************************************************************
+* COMMAND PARSER CLASS
+********************************************************************************/
+
+/**
+ * @brief The option must be given in the command line
+ *
+ * @return CommandParser::Option&
+ */
+CommandParser::Option& CommandParser::Option::Required()
+{
+    is_required = true;
+    return *this;
+}
+
+/**
+ * @brief CommandParser Constructor
+ *
+ * @param command_name First word of the command line
+ */
+CommandParser::CommandParser(std::string_view command_name) : name(command_name)
+{
+    options.reserve(16);
+}
+
+/**
+ * @brief Add a flag, the member is set to true when the flag is given
+ *
+ * @param names Short and long names, as "-l,--LOOP"
+ * @param member
+ * @param description
+ * @return Option&
+ */
+CommandParser::Option& CommandParser::AddFlag(std::string_view names, bool& member, std::string_view description)
+{
+    return Add(names, Target(&member), description, true);
+}
+
+CommandParser::Option& CommandParser::Add(std::string_view names, Target target, std::string_view description,
+                                          bool is_flag)
+{
+    Option& option = options.emplace_back();
+
+    size_t comma = names.find(',');
+    option.short_name = names.substr(0, comma);
+    option.long_name = (comma == std::string_view::npos) ? option.short_name : names.substr(comma + 1);
+    option.description = description;
+    option.target = target;
+    option.is_flag = is_flag;
+
+    return option;
+}
+
+CommandParser::Option* CommandParser::Find(std::string_view key)
+{
+    for (Option& option : options)
+    {
+        if (key == option.short_name || key == option.long_name)
+        {
+            return &option;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Parse the command line, the members of the given options are written
+ *
+ * @param line Command line without comments
+ */
+void CommandParser::Parse(std::string_view line)
+{
+    std::vector<std::string> tokens;
+    Split(line, tokens);
+
+    if (tokens.empty() || tokens[0] != name)
+    {
+        throw std::runtime_error("the command does not start with " + std::string(name));
+    }
+
+    for (size_t i = 1; i < tokens.size(); i++)
+    {
+        const std::string& token = tokens[i];
+
+        if (token.size() < 2 || token[0] != '-')
+        {
+            throw std::runtime_error("unexpected argument <" + token + ">");
+        }
+
+        /* --NAME=value */
+        std::string_view key = token;
+        std::string value;
+        bool has_value = false;
+        size_t equal = token.find('=');
+
+        if (token.starts_with("--") && equal != std::string::npos)
+        {
+            key = key.substr(0, equal);
+            value = token.substr(equal + 1);
+            has_value = true;
+        }
+
+        Option* option = Find(key);
+
+        if (option == nullptr)
+        {
+            throw std::runtime_error("unknown option <" + std::string(key) + ">");
+        }
+
+        if (option->is_found)
+        {
+            throw std::runtime_error("option " + std::string(option->long_name) + " is given more than once");
+        }
+        option->is_found = true;
+
+        if (option->is_flag)
+        {
+            if (has_value)
+            {
+                throw std::runtime_error("flag " + std::string(option->long_name) + " does not take a value");
+            }
+            *std::get<bool*>(option->target) = true;
+            continue;
+        }
+
+        /* The next token is the value, even if it starts with '-' */
+        if (!has_value)
+        {
+            if (i + 1 >= tokens.size())
+            {
+                throw std::runtime_error("option " + std::string(option->long_name) + " requires a value");
+            }
+            value = tokens[++i];
+        }
+
+        try
+        {
+            Convert(value, option->target);
+        }
+        catch (const std::exception& e)
+        {
+            throw std::runtime_error("option " + std::string(option->long_name) + " ("
+                                     + std::string(option->description) + "): " + e.what());
+        }
+    }
+
+    for (const Option& option : options)
+    {
+        if (option.is_required && !option.is_found)
+        {
+            throw std::runtime_error("option " + std::string(option.long_name) + " ("
+                                     + std::string(option.description) + ") is required");
+        }
+    }
+}
+
+/**
+ * @brief Split the line in words. Quotes group words and are removed.
+ *
+ * @param line
+ * @param tokens
+ */
+void CommandParser::Split(std::string_view line, std::vector<std::string>& tokens)
+{
+    std::string token;
+    bool in_token = false;
+    char quote = 0;
+
+    for (char c : line)
+    {
+        if (quote != 0)
+        {
+            if (c == quote)
+            {
+                quote = 0;
+            }
+            else
+            {
+                token += c;
+            }
+        }
+        else if (c == '"' || c == '\'')
+        {
+            quote = c;
+            in_token = true;
+        }
+        else if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+        {
+            if (in_token)
+            {
+                tokens.push_back(std::move(token));
+                token.clear();
+                in_token = false;
+            }
+        }
+        else
+        {
+            token += c;
+            in_token = true;
+        }
+    }
+
+    if (quote != 0)
+    {
+        throw std::runtime_error("unterminated quote in <" + std::string(line) + ">");
+    }
+
+    if (in_token)
+    {
+        tokens.push_back(std::move(token));
+    }
+}
+
+/**
+ * @brief Write the text value in the member of the option
+ *
+ * @param text
+ * @param target
+ */
+void CommandParser::Convert(const std::string& text, Target target)
+{
+    const char* first = text.data();
+    const char* last = text.data() + text.size();
+
+    std::visit([&](auto* member)
+    {
+        using T = std::remove_pointer_t<decltype(member)>;
+
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            *member = text;
+        }
+        else if constexpr (std::is_same_v<T, char>)
+        {
+            if (text.size() != 1)
+            {
+                throw std::runtime_error("<" + text + "> is not a single character");
+            }
+            *member = text[0];
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            if (text != "true" && text != "false" && text != "1" && text != "0")
+            {
+                throw std::runtime_error("<" + text + "> is not a boolean");
+            }
+            *member = (text == "true" || text == "1");
+        }
+        else
+        {
+            /* size_t or double */
+            auto [ptr, ec] = std::from_chars(first, last, *member);
+            if (text.empty() || ec != std::errc() || ptr != last)
+            {
+                throw std::runtime_error("<" + text + "> is not a valid number");
+            }
+        }
+    }, target);
+}
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+/*******************************************************************************
+* COMMAND PARSER CLASS
+********************************************************************************/
+
+/**
+ * @brief Parses a command line into the members of a command
+ *
+ * @details Options are written as -x value, --NAME value or --NAME=value and
+ * values with spaces are quoted. The parser only lives while the command is
+ * built, so option names must be string literals.
+ */
+class CommandParser
+{
+public:
+    using Target = std::variant<std::string*, char*, size_t*, double*, bool*>;
+
+    /**
+     * @brief Option bound to a member of the command
+     *
+     */
+    class Option
+    {
+    private:
+        friend class CommandParser;
+
+        std::string_view short_name;
+        std::string_view long_name;
+        std::string_view description;
+        Target target;
+        bool is_flag { false };
+        bool is_required { false };
+        bool is_found { false };
+
+    public:
+        Option& Required();
+    };
+
+    explicit CommandParser(std::string_view command_name);
+
+    template <typename T>
+    Option& AddOption(std::string_view names, T& member, std::string_view description);
+    Option& AddFlag(std::string_view names, bool& member, std::string_view description);
+
+    void Parse(std::string_view line);
+
+private:
+    std::string_view name;
+    std::vector<Option> options;
+
+    Option& Add(std::string_view names, Target target, std::string_view description, bool is_flag);
+    Option* Find(std::string_view key);
+    static void Split(std::string_view line, std::vector<std::string>& tokens);
+    static void Convert(const std::string& text, Target target);
+};
+
+/**
+ * @brief Add an option that takes a value
+ *
+ * @tparam T std::string, char, size_t, double or bool
+ * @param names Short and long names, as "-s,--SIGNAL"
+ * @param member Member written with the value
+ * @param description
+ * @return Option&
+ */
+template <typename T>
+CommandParser::Option& CommandParser::AddOption(std::string_view names, T& member, std::string_view description)
+{
+    return Add(names, Target(&member), description, false);
+}
@@ -40,6 +40,7 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <fstream>
 #include <limits>
 #include <unordered_set>
 
@@ -48,6 +49,7 @@
 ********************************************************************************/
 
 #include "final_log_command.hpp"
+#include "text_formatter.hpp"
 
 /*******************************************************************************
 * FINAL LOG COMMAND CLASS
@@ -60,15 +62,15 @@
 FinalLogCommand::FinalLogCommand(std::string command)
 {
     /* Required options */
-    auto log_options = app->add_subcommand("FLOG", "Log a signal and the end");
-    log_options->add_option("-s,--SIGNAL", signal, "Signal name")->required();
+    CommandParser parser("FLOG");
+    parser.AddOption("-s,--SIGNAL", signal, "Signal name").Required();
 
     /* Optative options */
-    log_options->add_option("-t,--FILETYPE", file_type, "File type");
-    log_options->add_option("-n,--FILENAMETYPE", file_name_type, "File name type");
-    log_options->add_option("-f,--FORMAT", format, "Output format");
+    parser.AddOption("-t,--FILETYPE", file_type, "File type");
+    parser.AddOption("-n,--FILENAMETYPE", file_name_type, "File name type");
+    parser.AddOption("-f,--FORMAT", format, "Output format");
 
-    Parse(command);
+    Parse(command, parser);
 }
 
 /**
@@ -79,6 +81,19 @@ void FinalLogCommand::Init(AbstractHandlerPtr p_signal)
 {
     signal_ptr = p_signal;
 
+    /* Unsupported format */
+    if (!TextFormatter::IsValid(format))
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command error]: "
+                               + "in command <" + command_string
+                               + "> format <" + std::string(1, format)
+                               + "> is not supported, use 0, d, i or h.";
+
+        throw std::runtime_error(error_text);
+    }
+
     /* File name */
     std::string file_type_str = (file_type == FileType::TEXT) ? "txt" : "bin";
     
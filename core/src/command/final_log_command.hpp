@@ -42,6 +42,7 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <memory>
 #include <string>
 
 /*******************************************************************************
@@ -77,7 +78,7 @@ public:
     /* Options */
     enum FileType {TEXT = 't', BINARY = 'b'};
     enum FileNameType {SHORT = 's', LONG = 'l'};
-    enum Format {DEFAULT = '0'};
+    enum Format {DEFAULT = '0', DOUBLE = 'd', INTEGER = 'i', HEX = 'h'};
 
     /* Command fields */
     std::string signal;
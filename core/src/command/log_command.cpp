@@ -47,7 +47,9 @@
 * LOCAL HEADERS
 ********************************************************************************/
 
+#include "clock.hpp"
 #include "log_command.hpp"
+#include "text_formatter.hpp"
 
 /*******************************************************************************
 * LOG COMMAND CLASS
@@ -56,20 +58,20 @@
 LogCommand::LogCommand(std::string command)
 {
     /* Required options */
-    auto log_options = app->add_subcommand("LOG", "Log a signal");
-    log_options->add_option("-s,--SIGNAL", signal, "Signal name")->required();
-    log_options->add_option("-c,--CLOCK", clock, "Clock name")->required();
+    CommandParser parser("LOG");
+    parser.AddOption("-s,--SIGNAL", signal, "Signal name").Required();
+    parser.AddOption("-c,--CLOCK", clock, "Clock name").Required();
 
     /* Optative options */
-    log_options->add_option("-e,--EDGE", edge, "Clock edge");
-    log_options->add_option("-b,--BEGIN", begin, "First reference clock tick");
-    log_options->add_option("-p,--STEP", step, "Clock tick step");
-    log_options->add_option("-d,--END", end, "Last reference clock tick");
-    log_options->add_option("-t,--FILETYPE", file_type, "File type");
-    log_options->add_option("-n,--FILENAMETYPE", file_name_type, "File name type");
-    log_options->add_option("-f,--FORMAT", format, "Output format");
-
-    Parse(command);
+    parser.AddOption("-e,--EDGE", edge, "Clock edge");
+    parser.AddOption("-b,--BEGIN", begin, "First reference clock tick");
+    parser.AddOption("-p,--STEP", step, "Clock tick step");
+    parser.AddOption("-d,--END", end, "Last reference clock tick");
+    parser.AddOption("-t,--FILETYPE", file_type, "File type");
+    parser.AddOption("-n,--FILENAMETYPE", file_name_type, "File name type");
+    parser.AddOption("-f,--FORMAT", format, "Output format");
+
+    Parse(command, parser);
 }
 
 void LogCommand::Init(AbstractHandlerPtr p_signal)
@@ -109,6 +111,19 @@ void LogCommand::Init(AbstractHandlerPtr p_signal)
         throw std::runtime_error(error_text);
     }
 
+    /* Unsupported format */
+    if (!TextFormatter::IsValid(format))
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command error]: "
+                               + "in command <" + command_string
+                               + "> format <" + std::string(1, format)
+                               + "> is not supported, use 0, d, i or h.";
+
+        throw std::runtime_error(error_text);
+    }
+
     /* Log window (in ticks) */
     limit = end - begin;
     counter = 0;
@@ -137,8 +152,22 @@ void LogCommand::Init(AbstractHandlerPtr p_signal)
     }
 }
 
-void LogCommand::Run(std::string output_path, size_t buffer_size)
+void LogCommand::Run(LogWriter& writer, const std::string& output_path, size_t buffer_size)
 {
+    /* Waveform: only the changes, at the time of the clock edge */
+    if (waveform)
+    {
+        waveform->Sample(waveform_index, clock_ptr->GetLastEdgeTicks(), *signal_ptr);
+        counter++;
+        return;
+    }
+
+    /* Sample straight into the mapped file, unless another log owns the buffer */
+    if (counter == 0 && file_type == FileType::MAPPED && !signal_ptr->IsBufferCreated())
+    {
+        MapFile(output_path);
+    }
+
     /* Create buffer if it doesn't exist */
     if (!signal_ptr->IsBufferCreated())
     {
@@ -152,94 +181,176 @@ void LogCommand::Run(std::string output_path, size_t buffer_size)
         }
     }
 
-    /* Create and clear the file */
-    if (counter == 0)
+    /* Create and clear the file, samples past the window are appended */
+    if (!sink && !mapped_file)
     {
-        std::string file_full_name = output_path + file_name;
-
-        if (file_type == FileType::TEXT)
-        {
-            std::ofstream file(file_full_name, std::ofstream::out);
-            file.close();
-        }
-        else
-        {
-            std::ofstream file(file_full_name, std::ofstream::out
-                                             | std::ofstream::binary);
-            file.close();
-        }
+        sink = container ? container->GetSink()
+                         : writer.Open(output_path + file_name, file_type != FileType::TEXT, counter != 0);
     }
 
     /* Save signal sample in the buffer */
     signal_ptr->SaveSample();
     counter++;
 
-    /* Flush to file */
-    if (counter >= limit || signal_ptr->BufferIsFull())
+    /* Mapped file: move to the next window or trim the file */
+    if (mapped_file)
     {
-        std::string file_full_name = output_path + file_name;
+        window_counter++;
 
-        if (file_type == FileType::TEXT)
+        if (counter >= limit)
         {
-            std::ofstream file(file_full_name, std::ofstream::out
-                                             | std::ofstream::app);
-            
-            if (file.is_open())
-            {
-                signal_ptr->FlushToTextFile(file, format);
-                file.close();
-            }
+            mapped_file->Close(window_counter);
+            mapped_file.reset();
+            signal_ptr->DeleteBuffer();
         }
-        else
+        else if (signal_ptr->BufferIsFull())
         {
-            std::ofstream file(file_full_name, std::ofstream::out
-                                             | std::ofstream::app 
-                                             | std::ofstream::binary);
-            if (file.is_open())
-            {
-                signal_ptr->FlushToBinaryFile(file);
-                file.close();
-            }
+            signal_ptr->AttachBuffer(mapped_file->Next(), mapped_file->GetWindowSamples());
+            window_counter = 0;
         }
+        return;
     }
 
-    /* Delete buffer */
+    /* Flush to file */
+    if (counter >= limit || signal_ptr->BufferIsFull())
+    {
+        Flush(writer);
+    }
+
+    /* Delete buffer and close the file, the container is closed by the logger */
     if (counter >= limit)
     {
         signal_ptr->DeleteBuffer();
+
+        if (!container)
+        {
+            writer.Close(*sink);
+        }
     }
 }
 
-bool LogCommand::IsActive()
+/**
+ * @brief Map the output file and use it as the buffer of the signal
+ * 
+ * @param output_path 
+ */
+void LogCommand::MapFile(const std::string& output_path)
 {
-    return signal_ptr->IsBufferCreated();
+    size_t max_value = std::numeric_limits<size_t>::max();
+
+    mapped_file = std::make_shared<MappedFile>();
+    mapped_file->Open(output_path + file_name, signal_ptr->GetSampleBytes(),
+                      (end == max_value) ? 0 : n_samples);
+
+    signal_ptr->AttachBuffer(mapped_file->GetWindow(), mapped_file->GetWindowSamples());
+    window_counter = 0;
 }
 
-void LogCommand::Terminate(std::string output_path)
+/**
+ * @brief Log into the container of the run instead of an own file
+ * 
+ * @param log_container 
+ */
+void LogCommand::Attach(LogContainer& log_container)
 {
-    std::string file_full_name = output_path + file_name;
+    LogContainer::Signal entry;
+    entry.name = signal;
+    entry.clock = clock;
+    entry.type = signal_ptr->GetTypeAsString();
+    entry.bytes = static_cast<uint32_t>(std::stoul(signal_ptr->GetNBytesAsString()));
+    entry.size = static_cast<uint32_t>(std::stoul(signal_ptr->GetSizeAsString()));
+    entry.edge = edge;
+    entry.begin = begin;
+    entry.step = step;
+    entry.end = end;
+
+    container = &log_container;
+    container_index = container->AddSignal(entry);
+}
+
+/**
+ * @brief Log the changes into the waveform file of the run
+ * 
+ * @param waveform_file 
+ */
+void LogCommand::Attach(WaveformFile& waveform_file)
+{
+    size_t n_values = signal_ptr->GetValueCount();
+    size_t size = std::stoul(signal_ptr->GetSizeAsString());
+
+    waveform = &waveform_file;
+    waveform_index = waveform->AddSignal(signal, signal_ptr->GetBitWidth(), n_values, size);
+}
+
+/**
+ * @brief Clock of the samples, whose edge times the waveform uses
+ * 
+ * @param p_clock 
+ */
+void LogCommand::SetClock(const Clock* p_clock)
+{
+    clock_ptr = p_clock;
+}
+
+/**
+ * @brief Hand the samples in the buffer over to the writer thread
+ * 
+ * @param writer 
+ */
+void LogCommand::Flush(LogWriter& writer)
+{
+    std::string chunk = writer.Acquire(*sink);
+    ChunkBuffer chunk_buffer(chunk);
+    std::ostream stream(&chunk_buffer);
 
-    /* Flush to file */
     if (file_type == FileType::TEXT)
     {
-        std::ofstream file(file_full_name, std::ofstream::out
-                                         | std::ofstream::app);
-        if (file.is_open())
-        {
-            signal_ptr->FlushToTextFile(file, format);
-            file.close();
-        }
+        signal_ptr->FlushToTextFile(stream, format);
     }
     else
     {
-        std::ofstream file(file_full_name, std::ofstream::out
-                                         | std::ofstream::app 
-                                         | std::ofstream::binary);
-        if (file.is_open())
-        {
-            signal_ptr->FlushToBinaryFile(file);
-            file.close();
-        }
+        signal_ptr->FlushToBinaryFile(stream);
+    }
+
+    if (container)
+    {
+        container->Write(writer, container_index, std::move(chunk));
+    }
+    else
+    {
+        writer.Write(*sink, std::move(chunk));
+    }
+}
+
+bool LogCommand::IsActive()
+{
+    return !waveform && signal_ptr->IsBufferCreated();
+}
+
+void LogCommand::Terminate(LogWriter& writer, const std::string& output_path)
+{
+    /* Trim the mapped file after the last sample */
+    if (mapped_file)
+    {
+        mapped_file->Close(window_counter);
+        mapped_file.reset();
+        signal_ptr->DeleteBuffer();
+        return;
+    }
+
+    /* A log sharing the buffer of another one may have never run */
+    if (!sink)
+    {
+        sink = container ? container->GetSink()
+                         : writer.Open(output_path + file_name, file_type != FileType::TEXT, true);
+    }
+
+    /* Flush to file */
+    Flush(writer);
+
+    if (!container)
+    {
+        writer.Close(*sink);
     }
 
     /* Delete buffer */
@@ -50,6 +50,10 @@
 
 #include "abstract_handler.hpp"
 #include "command.hpp"
+#include "log_container.hpp"
+#include "log_writer.hpp"
+#include "mapped_file.hpp"
+#include "waveform_file.hpp"
 
 /*******************************************************************************
 * MACROS
@@ -61,6 +65,8 @@
 * LOG COMMAND CLASS
 ********************************************************************************/
 
+class Clock;
+
 class LogCommand : public Command
 {
 private:
@@ -76,14 +82,31 @@ private:
 
     /* Output file */
     std::string file_name;
+    LogWriter::SinkPtr sink;
+
+    /* Memory mapped output file */
+    std::shared_ptr<MappedFile> mapped_file;
+    size_t window_counter;
+
+    /* Container of the run */
+    LogContainer* container { nullptr };
+    size_t container_index { 0 };
+
+    /* Waveform file of the run and clock of the change times */
+    WaveformFile* waveform { nullptr };
+    size_t waveform_index { 0 };
+    const Clock* clock_ptr { nullptr };
+
+    void Flush(LogWriter& writer);
+    void MapFile(const std::string& output_path);
 
 public:
 
     /* Options */
-    enum FileType {TEXT = 't', BINARY = 'b'};
+    enum FileType {TEXT = 't', BINARY = 'b', MAPPED = 'm', CONTAINER = 'c', WAVEFORM = 'v'};
     enum FileNameType {SHORT = 's', LONG = 'l'};
     enum EdgeType {NEGATIVE = 'n', POSITIVE = 'p', BOTH = 'b'};
-    enum Format {DEFAULT = '0'};
+    enum Format {DEFAULT = '0', DOUBLE = 'd', INTEGER = 'i', HEX = 'h'};
 
     /* Command fields */
     std::string signal;
@@ -99,7 +122,10 @@ public:
     /* Command methods */
     LogCommand(std::string command);
     void Init(AbstractHandlerPtr p_signal);
-    void Run(std::string output_path, size_t buffer_size);
+    void Attach(LogContainer& log_container);
+    void Attach(WaveformFile& waveform_file);
+    void SetClock(const Clock* p_clock);
+    void Run(LogWriter& writer, const std::string& output_path, size_t buffer_size);
     bool IsActive();
-    void Terminate(std::string output_path);
+    void Terminate(LogWriter& writer, const std::string& output_path);
 };
\ No newline at end of file
@@ -40,12 +40,15 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <fstream>
 #include <limits>
+#include <sstream>
 
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
 
+#include "checkpoint.hpp"
 #include "set_command.hpp"
 
 /*******************************************************************************
@@ -59,59 +62,58 @@
 SetCommand::SetCommand(std::string command)
 {
     /* Required options */
-    auto set_options = app->add_subcommand("SET", "Set a signal value");
-    set_options->add_option("-v,--VALUE", value, "Value to set");
-    set_options->add_option("-f,--FILE", file, "File name");
-    set_options->add_option("-s,--SIGNAL", signal, "Signal name")->required();
-    set_options->add_option("-c,--CLOCK", clock, "Clock name")->required();
-    set_options->add_option("-e,--EDGE", edge, "Clock edge")->required();
-    set_options->add_option("-b,--BEGIN", begin, "First reference clock tick")->required();
-    set_options->add_option("-d,--END", end, "Last reference clock tick")->required();
-    
-    set_options->callback([&]()
+    CommandParser parser("SET");
+    parser.AddOption("-v,--VALUE", value, "Value to set");
+    parser.AddOption("-f,--FILE", file, "File name");
+    parser.AddOption("-w,--WAVEFORM", waveform, "Binary file, one sample per edge");
+    parser.AddFlag("-l,--LOOP", loop, "Play the waveform again after its last sample");
+    parser.AddOption("-s,--SIGNAL", signal, "Signal name").Required();
+    parser.AddOption("-c,--CLOCK", clock, "Clock name").Required();
+    parser.AddOption("-e,--EDGE", edge, "Clock edge").Required();
+    parser.AddOption("-b,--BEGIN", begin, "First reference clock tick").Required();
+    parser.AddOption("-d,--END", end, "Last reference clock tick").Required();
+
+    Parse(command, parser);
+
+    /* Check if exist FILE, VALUE or WAVEFORM options */
+    size_t count { 0 };
+    if (!value.empty()) { count += 1; }
+    if (!file.empty() ) { count += 1; }
+    if (!waveform.empty()) { count += 1; }
+
+    if (count != 1)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid SET command]: "
+                               + "in command <" + command_string 
+                               + "> only one option"
+                               + " is allowed (VALUE, FILE or WAVEFORM).";
+
+        throw std::runtime_error(error_text);
+    }
+
+    /* Data from file */
+    if (!file.empty())
+    {
+        std::ifstream file_handler(file);
+
+        if (!file_handler.is_open())
         {
-            /* Check if exist FILE or VALUE options */
-            size_t count { 0 };
-            if (!value.empty()) { count += 1; }
-            if (!file.empty() ) { count += 1; }
-
-            if (count != 1)
-            {
-                std::string error_text = std::string(__FILE__) + ":"
-                                       + std::to_string(__LINE__) + ": "
-                                       + "ERROR [invalid SET command]: "
-                                       + "in command <" + command_string 
-                                       + "> only one option"
-                                       + " is allowed (VALUE or FILE).";
-
-                throw std::runtime_error(error_text);
-            }
-
-            /* Data from file */
-            if (!file.empty())
-            {
-                std::ifstream file_handler(file);
-
-                if (!file_handler.is_open())
-                {
-                    std::string error_text = std::string(__FILE__) + ":"
-                                           + std::to_string(__LINE__) + ": "
-                                           + "ERROR [unopened file]: "
-                                           + "the file " + file + " in command <" 
-                                           + command_string 
-                                           + "> could not be opened correctly.";
-
-                    throw std::runtime_error(error_text);
-                }
-                    
-                std::stringstream buffer;
-                buffer << file_handler.rdbuf();
-                value = buffer.str();
-            }
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [unopened file]: "
+                                   + "the file " + file + " in command <" 
+                                   + command_string 
+                                   + "> could not be opened correctly.";
+
+            throw std::runtime_error(error_text);
         }
-    );
-
-    Parse(command);
+            
+        std::stringstream buffer;
+        buffer << file_handler.rdbuf();
+        value = buffer.str();
+    }
 }
 
 /**
@@ -159,6 +161,13 @@ void SetCommand::Init(AbstractHandlerPtr p_signal)
     /* Log window (in ticks) */
     limit = end - begin;
     counter = 0;
+
+    /* Samples of the waveform, as in binary LOG files */
+    if (!waveform.empty())
+    {
+        stimulus = std::make_shared<StimulusFile>();
+        stimulus->Open(waveform, signal_ptr->GetSampleBytes(), loop);
+    }
 }
 
 void SetCommand::Run()
@@ -166,19 +175,68 @@ void SetCommand::Run()
     /* Is beginning */
     if(!counter)
     {
-        original_value = signal_ptr->GetAsString();
+        original_value.resize(signal_ptr->GetValueBytes());
+        signal_ptr->GetValue(original_value.data());
     }
 
-    /* Set new value */
-    signal_ptr->SetFromString(value);
+    if (stimulus)
+    {
+        /* Next sample, the signal keeps the last one once the waveform ends */
+        const void* sample = stimulus->Next();
+
+        if (sample != nullptr)
+        {
+            signal_ptr->SetSample(sample);
+        }
+    }
+    else if (set_value.empty())
+    {
+        /* The value is parsed once, by the signal itself */
+        signal_ptr->SetFromString(value);
+
+        set_value.resize(signal_ptr->GetValueBytes());
+        signal_ptr->GetValue(set_value.data());
+    }
+    else
+    {
+        signal_ptr->SetValue(set_value.data());
+    }
 
     /* Is ending */
     if(counter > limit)
     {
-        signal_ptr->SetFromString(original_value);
+        signal_ptr->SetValue(original_value.data());
     }
     else
     {
         counter++;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Save the progress of the window and the values it keeps
+ * 
+ * @param stream 
+ */
+void SetCommand::SaveState(std::ostream& stream) const
+{
+    Checkpoint::Write(stream, counter);
+    Checkpoint::Write(stream, original_value);
+    Checkpoint::Write(stream, set_value);
+    Checkpoint::Write(stream, stimulus ? stimulus->GetIndex() : size_t { 0 });
+}
+
+void SetCommand::RestoreState(std::istream& stream)
+{
+    size_t sample;
+
+    Checkpoint::Read(stream, counter);
+    Checkpoint::Read(stream, original_value);
+    Checkpoint::Read(stream, set_value);
+    Checkpoint::Read(stream, sample);
+
+    if (stimulus)
+    {
+        stimulus->Seek(sample);
+    }
+}
@@ -42,7 +42,10 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <iosfwd>
+#include <memory>
 #include <string>
+#include <vector>
 
 /*******************************************************************************
 * LOCAL HEADERS
@@ -50,6 +53,7 @@
 
 #include "abstract_handler.hpp"
 #include "command.hpp"
+#include "stimulus_file.hpp"
 
 /*******************************************************************************
 * MACROS
@@ -67,6 +71,8 @@
  * 
  * @details "-v,--VALUE"    -> "Value to set, number or an array"
  * @details "-f,--FILE"     -> "Filename from which to load an array"
+ * @details "-w,--WAVEFORM" -> "Binary file with one sample per firing edge"
+ * @details "-l,--LOOP"     -> "Start the waveform again after its last sample"
  * @details "-s,--SIGNAL"   -> "Signal name"
  * @details "-c,--CLOCK"    -> "Clock name"
  * @details "-e,--EDGE"     -> "Clock edge"
@@ -86,8 +92,12 @@ private:
     size_t counter;
     size_t n_samples;
 
-    /* Value control */
-    std::string original_value;
+    /* Value control, in the type of the signal */
+    std::vector<char> set_value;
+    std::vector<char> original_value;
+
+    /* Waveform played one sample per run */
+    std::shared_ptr<StimulusFile> stimulus;
 
 public:
 
@@ -97,6 +107,8 @@ public:
     /* Command fields */
     std::string value;
     std::string file;
+    std::string waveform;
+    bool loop { false };
     std::string signal;
     std::string clock;
     char edge { EdgeType::POSITIVE };
@@ -107,4 +119,8 @@ public:
     SetCommand(std::string command);
     void Init(AbstractHandlerPtr p_signal);
     void Run();
+
+    /* Progress of the window, for checkpoints */
+    void SaveState(std::ostream& stream) const;
+    void RestoreState(std::istream& stream);
 };
\ No newline at end of file
@@ -0,0 +1,649 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "stat_command.hpp"
+
+/*******************************************************************************
+* STATIC FUNCTIONS
+********************************************************************************/
+
+/**
+ * @brief Appends a number as a yaml float, shortest round-trip
+ * 
+ * @param text 
+ * @param value 
+ */
+static void AppendNumber(std::string& text, double value)
+{
+    if (std::isnan(value))
+    {
+        text += ".nan";
+    }
+    else if (std::isinf(value))
+    {
+        text += (value > 0) ? ".inf" : "-.inf";
+    }
+    else
+    {
+        char digits[32];
+        char* last = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+        text.append(digits, last);
+    }
+}
+
+/**
+ * @brief Appends a count
+ * 
+ * @param text 
+ * @param value 
+ */
+static void AppendNumber(std::string& text, uint64_t value)
+{
+    char digits[32];
+    char* last = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+    text.append(digits, last);
+}
+
+/**
+ * @brief Appends a line with a flow sequence
+ * 
+ * @param text 
+ * @param prefix Text before the sequence
+ * @param n_values 
+ * @param value Function of the index returning each value
+ */
+template <typename F>
+static void AppendList(std::string& text, const std::string& prefix, size_t n_values, F value)
+{
+    text += prefix + "[";
+    for (size_t i { 0 }; i < n_values; i++)
+    {
+        text += (i == 0) ? "" : ", ";
+        AppendNumber(text, value(i));
+    }
+    text += "]\n";
+}
+
+/*******************************************************************************
+* STAT COMMAND CLASS
+********************************************************************************/
+
+StatCommand::StatCommand(std::string command)
+{
+    /* Required options */
+    CommandParser parser("STAT");
+    parser.AddOption("-s,--SIGNAL", signal, "Signal name").Required();
+    parser.AddOption("-c,--CLOCK", clock, "Clock name").Required();
+
+    /* Optative options */
+    parser.AddOption("-e,--EDGE", edge, "Clock edge");
+    parser.AddOption("-b,--BEGIN", begin, "First reference clock tick");
+    parser.AddOption("-p,--STEP", step, "Clock tick step");
+    parser.AddOption("-d,--END", end, "Last reference clock tick");
+    parser.AddOption("-k,--KINDS", kinds, "Statistics: mean,var,std,min,max,rms,hist:bins[:lower:upper]");
+    parser.AddOption("-w,--WINDOW", window, "Samples per window, 0 for the whole run only");
+    parser.AddOption("-n,--FILENAMETYPE", file_name_type, "File name type");
+
+    Parse(command, parser);
+}
+
+void StatCommand::Init(AbstractHandlerPtr p_signal)
+{
+    signal_ptr = p_signal;
+
+    /* Unsupported edge */
+    if (RUN_POSEDGE_LOGIC_ONLY && edge != EdgeType::POSITIVE)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [unsupported edge]: "
+                               + "in command <" + command_string 
+                               + "> the sampling edge is negedge but "
+                               + "RUN_POSEDGE_LOGIC_ONLY is ON.";
+        
+        throw std::runtime_error(error_text);
+    }
+
+    /* Full STAT */
+    if (begin >= end && end == 0)
+    {
+        end = std::numeric_limits<size_t>::max();
+    }
+
+    /* BEGIN before END */
+    if (begin > end)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command error]: "
+                               + "in command <" + command_string
+                               + "> begin tick <" + std::to_string(begin)
+                               + "> is grater than end tick <"
+                               + std::to_string(end) + ">.";
+
+        throw std::runtime_error(error_text);
+    }
+
+    ParseKinds();
+
+    /* Channels: array elements, real and imaginary parts */
+    size_t n_values = signal_ptr->GetValueCount();
+    size_t size = std::stoul(signal_ptr->GetSizeAsString());
+    bool is_complex = (n_values == 2 * size);
+
+    for (size_t i { 0 }; i < size; i++)
+    {
+        std::string element = (size == 1) ? "" : std::to_string(i);
+
+        if (is_complex)
+        {
+            channels.push_back(element + (element.empty() ? "" : ".") + "real");
+            channels.push_back(element + (element.empty() ? "" : ".") + "imag");
+        }
+        else
+        {
+            channels.push_back(element.empty() ? "value" : element);
+        }
+    }
+
+    values.resize(n_values);
+    window_stats.Reset(0, n_values, histogram_template, has_histogram);
+    total_stats.Reset(0, n_values, histogram_template, has_histogram);
+
+    /* File name */
+    size_t max_value = std::numeric_limits<size_t>::max();
+    std::string end_str = (end == max_value) ? "last" : std::to_string(end);
+
+    if (file_name_type == FileNameType::LONG)
+    {
+        file_name = "STAT_SIGNAL_" + signal
+                  + "_CLOCK_" + clock
+                  + "_BEGIN_" + std::to_string(begin)
+                  + "_END_" + end_str
+                  + "_STEP_" + std::to_string(step)
+                  + ".yaml";
+    }
+    else
+    {
+        file_name = signal + ".stat.yaml";
+    }
+}
+
+/**
+ * @brief Reads the requested statistics from the KINDS option
+ * 
+ */
+void StatCommand::ParseKinds()
+{
+    std::stringstream ss(kinds);
+    std::string kind;
+
+    while (std::getline(ss, kind, ','))
+    {
+        if (kind == "mean") { has_mean = true; continue; }
+        if (kind == "var") { has_var = true; continue; }
+        if (kind == "std") { has_std = true; continue; }
+        if (kind == "min") { has_min = true; continue; }
+        if (kind == "max") { has_max = true; continue; }
+        if (kind == "rms") { has_rms = true; continue; }
+
+        /* hist:bins or hist:bins:lower:upper */
+        if (kind.starts_with("hist:"))
+        {
+            std::stringstream fields(kind.substr(5));
+            std::string bins_str, lower_str, upper_str;
+            std::getline(fields, bins_str, ':');
+            std::getline(fields, lower_str, ':');
+            std::getline(fields, upper_str, ':');
+
+            try
+            {
+                size_t bins = std::stoul(bins_str);
+
+                if (!lower_str.empty() || !upper_str.empty())
+                {
+                    double lower = std::stod(lower_str);
+                    double upper = std::stod(upper_str);
+
+                    if (bins >= 1 && upper > lower)
+                    {
+                        histogram_template.counts.assign(bins, 0);
+                        histogram_template.lower = lower;
+                        histogram_template.width = (upper - lower) / static_cast<double>(bins);
+                        histogram_template.is_fixed = true;
+                        has_histogram = true;
+                        continue;
+                    }
+                }
+                else if (bins >= 2)
+                {
+                    /* Bins are merged in pairs */
+                    histogram_template.counts.assign(bins + bins % 2, 0);
+                    has_histogram = true;
+                    continue;
+                }
+            }
+            catch (const std::exception&)
+            {
+            }
+        }
+
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command error]: "
+                               + "in command <" + command_string
+                               + "> statistic <" + kind
+                               + "> is not valid, use mean, var, std, min, max, rms, "
+                               + "hist:bins or hist:bins:lower:upper.";
+
+        throw std::runtime_error(error_text);
+    }
+}
+
+void StatCommand::Run(const std::string& output_path)
+{
+    if (!file)
+    {
+        Open(output_path);
+    }
+
+    signal_ptr->GetValues(values.data());
+    total_stats.Add(values);
+    counter++;
+
+    if (window == 0)
+    {
+        return;
+    }
+
+    window_stats.Add(values);
+
+    /* Window snapshot */
+    if (window_stats.n_samples >= window)
+    {
+        Write(window_stats, "  - ", "    ");
+        window_stats.Reset(counter, values.size(), histogram_template, has_histogram);
+    }
+}
+
+void StatCommand::Terminate(const std::string& output_path)
+{
+    if (!file)
+    {
+        Open(output_path);
+    }
+
+    /* Incomplete window */
+    if (window != 0 && window_stats.n_samples != 0)
+    {
+        Write(window_stats, "  - ", "    ");
+    }
+
+    if (n_windows == 0)
+    {
+        *file << "windows: []\n";
+    }
+
+    *file << "total:\n";
+    Write(total_stats, "  ", "  ");
+    file->close();
+}
+
+/**
+ * @brief Creates the result file and writes the description of the command
+ * 
+ * @param output_path 
+ */
+void StatCommand::Open(const std::string& output_path)
+{
+    file = std::make_shared<std::ofstream>(output_path + file_name);
+
+    if (!file->is_open())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + output_path + file_name;
+
+        throw std::runtime_error(error_text);
+    }
+
+    size_t max_value = std::numeric_limits<size_t>::max();
+
+    std::string text = "signal: " + signal + "\n"
+                     + "clock: " + clock + "\n"
+                     + "type: " + signal_ptr->GetTypeAsString() + "\n"
+                     + "edge: " + edge + "\n"
+                     + "begin: " + std::to_string(begin) + "\n"
+                     + "end: " + ((end == max_value) ? "last" : std::to_string(end)) + "\n"
+                     + "step: " + std::to_string(step) + "\n"
+                     + "channels: [";
+
+    for (size_t i { 0 }; i < channels.size(); i++)
+    {
+        text += ((i == 0) ? "" : ", ") + channels[i];
+    }
+    text += "]\n";
+
+    *file << text;
+}
+
+/**
+ * @brief Writes the statistics of a window or of the run
+ * 
+ * @param stats 
+ * @param prefix First line prefix
+ * @param indent Prefix of the other lines
+ */
+void StatCommand::Write(const Stats& stats, const std::string& prefix, const std::string& indent)
+{
+    const std::vector<Moments>& moments = stats.moments;
+    const size_t n_channels = moments.size();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    auto var = [&](size_t i)
+    {
+        return (moments[i].n == 0) ? nan : moments[i].m2 / static_cast<double>(moments[i].n);
+    };
+
+    std::string text;
+
+    if (prefix != indent && n_windows++ == 0)
+    {
+        text += "windows:\n";
+    }
+
+    text += prefix + "first: " + std::to_string(stats.first_sample) + "\n";
+    text += indent + "samples: " + std::to_string(stats.n_samples) + "\n";
+
+    if (has_mean)
+    {
+        AppendList(text, indent + "mean: ", n_channels,
+                   [&](size_t i) { return (moments[i].n == 0) ? nan : moments[i].mean; });
+    }
+
+    if (has_var)
+    {
+        AppendList(text, indent + "var: ", n_channels, var);
+    }
+
+    if (has_std)
+    {
+        AppendList(text, indent + "std: ", n_channels, [&](size_t i) { return std::sqrt(var(i)); });
+    }
+
+    if (has_min)
+    {
+        AppendList(text, indent + "min: ", n_channels,
+                   [&](size_t i) { return (moments[i].n == 0) ? nan : moments[i].min; });
+    }
+
+    if (has_max)
+    {
+        AppendList(text, indent + "max: ", n_channels,
+                   [&](size_t i) { return (moments[i].n == 0) ? nan : moments[i].max; });
+    }
+
+    if (has_rms)
+    {
+        AppendList(text, indent + "rms: ", n_channels,
+                   [&](size_t i) { return std::sqrt(var(i) + moments[i].mean * moments[i].mean); });
+    }
+
+    if (has_histogram)
+    {
+        const std::vector<Histogram>& histograms = stats.histograms;
+
+        /* Until two different values are seen all of them are in the first bin */
+        auto is_ranged = [&](size_t i) { return histograms[i].is_fixed || histograms[i].is_ranged; };
+
+        text += indent + "hist:\n";
+        AppendList(text, indent + "  lower: ", n_channels,
+                   [&](size_t i) { return is_ranged(i) ? histograms[i].lower : histograms[i].first; });
+        AppendList(text, indent + "  width: ", n_channels, [&](size_t i) { return histograms[i].width; });
+        AppendList(text, indent + "  below: ", n_channels, [&](size_t i) { return histograms[i].below; });
+        AppendList(text, indent + "  above: ", n_channels, [&](size_t i) { return histograms[i].above; });
+
+        text += indent + "  counts:\n";
+        for (const Histogram& histogram : histograms)
+        {
+            AppendList(text, indent + "    - ", histogram.counts.size(),
+                       [&](size_t i) { return histogram.counts[i] + ((i == 0) ? histogram.n_first : 0); });
+        }
+    }
+
+    *file << text;
+    file->flush();
+}
+
+/*******************************************************************************
+* ACCUMULATORS
+********************************************************************************/
+
+/**
+ * @brief Restarts the accumulators
+ * 
+ * @param first Index of the first sample
+ * @param n_channels 
+ * @param histogram Empty histogram of each channel
+ * @param has_histogram 
+ */
+void StatCommand::Stats::Reset(uint64_t first, size_t n_channels, const Histogram& histogram, bool has_histogram)
+{
+    first_sample = first;
+    n_samples = 0;
+    moments.assign(n_channels, Moments());
+    histograms.assign(has_histogram ? n_channels : 0, histogram);
+}
+
+/**
+ * @brief Adds a sample
+ * 
+ * @param values One per channel
+ */
+void StatCommand::Stats::Add(const std::vector<double>& values)
+{
+    for (size_t i { 0 }; i < values.size(); i++)
+    {
+        moments[i].Add(values[i]);
+    }
+
+    for (size_t i { 0 }; i < histograms.size(); i++)
+    {
+        histograms[i].Add(values[i]);
+    }
+
+    n_samples++;
+}
+
+/**
+ * @brief Welford update, numerically stable for long runs
+ * 
+ * @param value 
+ */
+void StatCommand::Moments::Add(double value)
+{
+    n++;
+    double delta = value - mean;
+    mean += delta / static_cast<double>(n);
+    m2 += delta * (value - mean);
+
+    /* NaN propagates, as in numpy */
+    if (n == 1 || std::isnan(value))
+    {
+        min = value;
+        max = value;
+    }
+    else
+    {
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+}
+
+/**
+ * @brief Counts a value. Infinities are counted below or above the range
+ * and NaN is not counted.
+ * 
+ * @param value 
+ */
+void StatCommand::Histogram::Add(double value)
+{
+    const size_t n_bins = counts.size();
+
+    if (!std::isfinite(value))
+    {
+        below += (value < 0) ? 1 : 0;
+        above += (value > 0) ? 1 : 0;
+        return;
+    }
+
+    /* Without range until two different values are seen */
+    if (!is_fixed && !is_ranged)
+    {
+        if (n_first == 0 || !(value < first || value > first))
+        {
+            first = value;
+            n_first++;
+            return;
+        }
+
+        SetRange(std::min(first, value), std::max(first, value));
+        counts[(first < value) ? 0 : n_bins - 1] += n_first;
+        n_first = 0;
+    }
+
+    /* Grow to hold the value */
+    if (!is_fixed)
+    {
+        while (value < lower)
+        {
+            GrowDown();
+        }
+
+        while (value >= lower + width * static_cast<double>(n_bins))
+        {
+            GrowUp();
+        }
+    }
+
+    double index = (value - lower) / width;
+
+    if (index < 0)
+    {
+        below++;
+    }
+    else if (index >= static_cast<double>(n_bins))
+    {
+        /* Rounding of the upper edge when growing */
+        if (is_fixed)
+        {
+            above++;
+        }
+        else
+        {
+            counts[n_bins - 1]++;
+        }
+    }
+    else
+    {
+        counts[static_cast<size_t>(index)]++;
+    }
+}
+
+/**
+ * @brief First range of a histogram without range, min in the first bin and
+ * max in the last one
+ * 
+ * @param min 
+ * @param max 
+ */
+void StatCommand::Histogram::SetRange(double min, double max)
+{
+    lower = min;
+    width = std::max((max - min) / static_cast<double>(counts.size() - 1),
+                     std::numeric_limits<double>::min());
+    is_ranged = true;
+}
+
+/**
+ * @brief Doubles the bin width keeping the lower edge
+ * 
+ */
+void StatCommand::Histogram::GrowUp()
+{
+    const size_t half = counts.size() / 2;
+
+    for (size_t i { 0 }; i < half; i++)
+    {
+        counts[i] = counts[2 * i] + counts[2 * i + 1];
+    }
+    std::fill(counts.begin() + static_cast<std::ptrdiff_t>(half), counts.end(), 0);
+    width *= 2;
+}
+
+/**
+ * @brief Doubles the bin width keeping the upper edge
+ * 
+ */
+void StatCommand::Histogram::GrowDown()
+{
+    const size_t half = counts.size() / 2;
+
+    for (size_t i { half }; i-- > 0;)
+    {
+        counts[half + i] = counts[2 * i] + counts[2 * i + 1];
+    }
+    std::fill(counts.begin(), counts.begin() + static_cast<std::ptrdiff_t>(half), 0);
+    lower -= width * static_cast<double>(counts.size());
+    width *= 2;
+}
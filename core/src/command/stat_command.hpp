@@ -0,0 +1,177 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "abstract_handler.hpp"
+#include "command.hpp"
+
+/*******************************************************************************
+* MACROS
+********************************************************************************/
+
+#define RUN_POSEDGE_LOGIC_ONLY _RUN_POSEDGE_LOGIC_ONLY
+
+/*******************************************************************************
+* STAT COMMAND CLASS
+********************************************************************************/
+
+/**
+ * @brief Statistics of a signal computed while the simulation runs, instead
+ * of logging its samples. Each value of a sample (array element, real or
+ * imaginary part) is a channel with its own accumulators. The results are
+ * written to a small yaml file, one entry per window and one for the run.
+ */
+class StatCommand : public Command
+{
+private:
+
+    /* Signal */
+    using AbstractHandlerPtr = std::shared_ptr<AbstractHandler>;
+    AbstractHandlerPtr signal_ptr;
+
+    /* Online mean, variance (Welford), minimum and maximum */
+    struct Moments
+    {
+        uint64_t n { 0 };
+        double mean { 0.0 };
+        double m2 { 0.0 };
+        double min { 0.0 };
+        double max { 0.0 };
+
+        void Add(double value);
+    };
+
+    /* Histogram of fixed size. Without range it starts at the first values
+    and doubles its bin width, merging pairs of bins, to hold new ones */
+    struct Histogram
+    {
+        std::vector<uint64_t> counts;
+        double lower { 0.0 };
+        double width { 0.0 };
+        uint64_t below { 0 };
+        uint64_t above { 0 };
+        bool is_fixed { false };
+        bool is_ranged { false };
+        double first { 0.0 };
+        uint64_t n_first { 0 };
+
+        void Add(double value);
+        void SetRange(double min, double max);
+        void GrowUp();
+        void GrowDown();
+    };
+
+    /* Accumulators of every channel */
+    struct Stats
+    {
+        uint64_t first_sample { 0 };
+        uint64_t n_samples { 0 };
+        std::vector<Moments> moments;
+        std::vector<Histogram> histograms;
+
+        void Reset(uint64_t first, size_t n_channels, const Histogram& histogram, bool has_histogram);
+        void Add(const std::vector<double>& values);
+    };
+
+    /* Samples taken and windows written */
+    uint64_t counter { 0 };
+    size_t n_windows { 0 };
+
+    /* Requested statistics */
+    bool has_mean { false };
+    bool has_var { false };
+    bool has_std { false };
+    bool has_min { false };
+    bool has_max { false };
+    bool has_rms { false };
+    bool has_histogram { false };
+    Histogram histogram_template;
+
+    /* Accumulators */
+    std::vector<std::string> channels;
+    std::vector<double> values;
+    Stats window_stats;
+    Stats total_stats;
+
+    /* Output file */
+    std::string file_name;
+    std::shared_ptr<std::ofstream> file;
+
+    void ParseKinds();
+    void Open(const std::string& output_path);
+    void Write(const Stats& stats, const std::string& prefix, const std::string& indent);
+
+public:
+
+    /* Options */
+    enum FileNameType {SHORT = 's', LONG = 'l'};
+    enum EdgeType {NEGATIVE = 'n', POSITIVE = 'p', BOTH = 'b'};
+
+    /* Command fields */
+    std::string signal;
+    std::string clock;
+    char edge { EdgeType::POSITIVE };
+    size_t begin { 0 };
+    size_t step { 1 };
+    size_t end { 0 };
+    std::string kinds { "mean,var,min,max" };
+    size_t window { 0 };
+    char file_name_type { FileNameType::LONG };
+
+    /* Command methods */
+    StatCommand(std::string command);
+    void Init(AbstractHandlerPtr p_signal);
+    void Run(const std::string& output_path);
+    void Terminate(const std::string& output_path);
+};
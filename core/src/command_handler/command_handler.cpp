@@ -40,7 +40,10 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <type_traits>
 
 /*******************************************************************************
 * LOCAL HEADERS
@@ -69,13 +72,21 @@ void CommandHandler::Init(std::string &file_name, HandlersMap nested_variable_ma
     /* Close command file */
     file_handler.close();
 
+    /* One command per signal matching a pattern */
+    ExpandSignals(nested_variable_map);
+
     /* Link each command with it signals */
     LoadSignals(nested_variable_map);
 
+    /* Queue each command in the edges of its clock */
+    LoadClocks(nested_variable_map);
+
     /* Define output size */
     logs.reserve(log_list.size());
     flogs.reserve(flog_list.size());
     sets.reserve(set_list.size());
+    stats.reserve(stat_list.size());
+    captures.reserve(capture_list.size());
 }
 
 /**
@@ -134,6 +145,22 @@ void CommandHandler::LoadCommands(std::ifstream &file_handler)
             continue;
         }
 
+        /* Check if it is a Stat command */
+        if (command_str.starts_with("STAT "))
+        {
+            StatCommand stat(command_str);
+            stat_list.push_back(stat);
+            continue;
+        }
+
+        /* Check if it is a Capture command */
+        if (command_str.starts_with("CAPTURE "))
+        {
+            CaptureCommand capture(command_str);
+            capture_list.push_back(capture);
+            continue;
+        }
+
         /* Check if it is a Set command */
         if (command_str.starts_with("SET "))
         {
@@ -152,6 +179,72 @@ void CommandHandler::LoadCommands(std::ifstream &file_handler)
     }
 }
 
+/**
+ * @brief Replace each command whose signal is a pattern by one copy of the
+ * command per matching signal, in name order.
+ * 
+ * @param nested_variable_map 
+ */
+void CommandHandler::ExpandSignals(const HandlersMap &nested_variable_map)
+{
+    if (!HasPatterns(log_list) && !HasPatterns(flog_list) && !HasPatterns(set_list)
+        && !HasPatterns(stat_list) && !HasPatterns(capture_list))
+    {
+        return;
+    }
+
+    SignalIndex index(nested_variable_map);
+
+    Expand(log_list, index);
+    Expand(flog_list, index);
+    Expand(set_list, index);
+    Expand(stat_list, index);
+    Expand(capture_list, index);
+}
+
+template <typename T>
+bool CommandHandler::HasPatterns(const std::vector<T>& list)
+{
+    return std::any_of(list.begin(), list.end(),
+                       [](const T& command) { return SignalIndex::IsPattern(command.signal); });
+}
+
+template <typename T>
+void CommandHandler::Expand(std::vector<T>& list, const SignalIndex& index)
+{
+    std::vector<T> expanded;
+    expanded.reserve(list.size());
+
+    for (T& command : list)
+    {
+        if (!SignalIndex::IsPattern(command.signal))
+        {
+            expanded.push_back(std::move(command));
+            continue;
+        }
+
+        std::vector<std::string> matches = index.Find(command.signal);
+
+        if (matches.empty())
+        {
+            std::string error_text = std::string(__FILE__) + ": "
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [unknown reference]: "
+                                   + "no signal matches " + command.signal;
+
+            throw std::runtime_error(error_text);
+        }
+
+        for (std::string& name : matches)
+        {
+            T& copy = expanded.emplace_back(command);
+            copy.signal = std::move(name);
+        }
+    }
+
+    list = std::move(expanded);
+}
+
 /**
  * @brief Add to each command the reference to the associated signal.
  * 
@@ -203,6 +296,39 @@ void CommandHandler::LoadSignals(HandlersMap &nested_variable_map)
         }
         set.Init(nested_variable_map[set.signal]);
     }
+
+    /* Link stat commands with signals */
+    for (StatCommand& stat : stat_list)
+    {
+        if (nested_variable_map.count(stat.signal) == 0)
+        {
+            std::string error_text = std::string(__FILE__) + ": "
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [unknown reference]: "
+                                   + stat.signal;
+
+            throw std::runtime_error(error_text);
+        }
+        stat.Init(nested_variable_map[stat.signal]);
+    }
+
+    /* Link capture commands with signals and triggers */
+    for (CaptureCommand& capture : capture_list)
+    {
+        for (const std::string& name : {capture.signal, capture.trigger})
+        {
+            if (nested_variable_map.count(name) == 0)
+            {
+                std::string error_text = std::string(__FILE__) + ": "
+                                       + std::to_string(__LINE__) + ": "
+                                       + "ERROR [unknown reference]: "
+                                       + name;
+
+                throw std::runtime_error(error_text);
+            }
+        }
+        capture.Init(nested_variable_map[capture.signal], nested_variable_map[capture.trigger]);
+    }
 }
 
 /**
@@ -210,42 +336,340 @@ void CommandHandler::LoadSignals(HandlersMap &nested_variable_map)
  * 
  * @param ptr_clocks 
  */
-void CommandHandler::Run(std::deque<Clock*>& ptr_clocks)
+void CommandHandler::Run(std::vector<Clock*>& ptr_clocks)
 {
-    sets.clear();
-    logs.clear();
+    tick = i_reference_clock->GetTickCount();
+    Run(ptr_clocks, tick, sets, logs, stats, captures);
+}
 
-    const auto &ref_clock_tick = i_reference_clock->GetTickCount();
+/**
+ * @brief Determines the commands to execute related to ptr_clocks, for a
+ * given reference clock tick. The clock domains run it concurrently, each
+ * one with its own output lists.
+ * 
+ * @param ptr_clocks 
+ * @param ref_clock_tick 
+ * @param next_sets 
+ * @param next_logs 
+ * @param next_stats 
+ * @param next_captures 
+ */
+void CommandHandler::Run(std::vector<Clock*>& ptr_clocks, unsigned long long ref_clock_tick,
+                         std::vector<SetCommand*>& next_sets, std::vector<LogCommand*>& next_logs,
+                         std::vector<StatCommand*>& next_stats,
+                         std::vector<CaptureCommand*>& next_captures)
+{
+    next_sets.clear();
+    next_logs.clear();
+    next_stats.clear();
+    next_captures.clear();
 
     for (auto &ptr_clock : ptr_clocks)
     {
-        const auto &clk_name = ptr_clock->GetFullName();
-        const auto &clk_edge = ptr_clock->GetNextEdgeType();
+        ClockCommands* commands = FindClockCommands(ptr_clock);
+
+        if (commands == nullptr)
+        {
+            continue;
+        }
+
+        size_t edge = (ptr_clock->GetNextEdgeType() == Clock::POSITIVE) ? 0 : 1;
 
         /* Add log commands to next_logs list */
-        for (LogCommand& log : log_list)
+        Collect(commands->logs[edge], log_list, ref_clock_tick, next_logs);
+
+        /* Add set commands to next_sets list */
+        Collect(commands->sets[edge], set_list, ref_clock_tick, next_sets);
+
+        /* Add stat commands to next_stats list */
+        Collect(commands->stats[edge], stat_list, ref_clock_tick, next_stats);
+
+        /* Add capture commands to next_captures list */
+        Collect(commands->captures[edge], capture_list, ref_clock_tick, next_captures);
+    }
+}
+
+/**
+ * @brief Resolves the clock of each command and queues the command in the
+ * edges it runs on. Commands on unknown clocks never run.
+ * 
+ * @param nested_variable_map 
+ */
+void CommandHandler::LoadClocks(HandlersMap &nested_variable_map)
+{
+    Queue(log_list, &ClockCommands::logs, GetStep, nested_variable_map);
+    Queue(set_list, &ClockCommands::sets, GetStep, nested_variable_map);
+    Queue(stat_list, &ClockCommands::stats, GetStep, nested_variable_map);
+    Queue(capture_list, &ClockCommands::captures, GetStep, nested_variable_map);
+}
+
+/**
+ * @brief Commands of the named clock, added the first time a command uses it
+ * 
+ * @param name 
+ * @param nested_variable_map 
+ * @return CommandHandler::ClockCommands* nullptr if name is not a clock
+ */
+CommandHandler::ClockCommands* CommandHandler::AddClockCommands(const std::string& name,
+                                                                HandlersMap& nested_variable_map)
+{
+    if (nested_variable_map.count(name) == 0)
+    {
+        return nullptr;
+    }
+
+    auto handler = std::dynamic_pointer_cast<Handler<Clock>>(nested_variable_map[name]);
+    if (!handler)
+    {
+        return nullptr;
+    }
+
+    const Clock* clock = static_cast<Clock*>(handler->GetPointer());
+    if (clock->GetFullName() != name)
+    {
+        return nullptr;
+    }
+
+    ClockCommands* commands = FindClockCommands(clock);
+    if (commands == nullptr)
+    {
+        clock_commands.push_back({});
+        commands = &clock_commands.back();
+        commands->clock = clock;
+    }
+    return commands;
+}
+
+/**
+ * @brief Commands of a clock, a linear search since only a few clocks have
+ * commands
+ * 
+ * @param clock 
+ * @return CommandHandler::ClockCommands* nullptr if the clock has no commands
+ */
+CommandHandler::ClockCommands* CommandHandler::FindClockCommands(const Clock* clock)
+{
+    for (ClockCommands& commands : clock_commands)
+    {
+        if (commands.clock == clock)
+        {
+            return &commands;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief First reference clock tick, from tick on, multiple of step and
+ * inside [begin, end)
+ * 
+ * @param begin 
+ * @param step 
+ * @param end 
+ * @param tick 
+ * @return size_t end if the command does not run again
+ */
+size_t CommandHandler::NextTick(size_t begin, size_t step, size_t end, unsigned long long tick)
+{
+    size_t next_tick = std::max(static_cast<size_t>(tick), begin);
+    size_t remainder = next_tick % step;
+
+    if (remainder != 0)
+    {
+        if (step - remainder >= end - std::min(next_tick, end))
+        {
+            return end;
+        }
+        next_tick += step - remainder;
+    }
+    return std::min(next_tick, end);
+}
+
+/**
+ * @brief Pushes a command in the heap of the queue
+ * 
+ * @param queue 
+ * @param next_tick 
+ * @param index 
+ */
+void CommandHandler::Schedule(CommandQueue& queue, size_t next_tick, size_t index)
+{
+    queue.heap.push_back({next_tick, index});
+    std::push_heap(queue.heap.begin(), queue.heap.end(),
+                   [](const Entry& a, const Entry& b) { return a.next_tick > b.next_tick; });
+}
+
+/**
+ * @brief Reference clock ticks between two runs of a log command
+ * 
+ * @param log 
+ * @return size_t 
+ */
+size_t CommandHandler::GetStep(const LogCommand& log)
+{
+    return log.step;
+}
+
+/**
+ * @brief Set commands run on every reference clock tick of their window
+ * 
+ * @param set 
+ * @return size_t 
+ */
+size_t CommandHandler::GetStep(const SetCommand& set)
+{
+    (void) set;
+    return 1;
+}
+
+/**
+ * @brief Reference clock ticks between two runs of a stat command
+ * 
+ * @param stat 
+ * @return size_t 
+ */
+size_t CommandHandler::GetStep(const StatCommand& stat)
+{
+    return stat.step;
+}
+
+/**
+ * @brief Reference clock ticks between two runs of a capture command
+ * 
+ * @param capture 
+ * @return size_t 
+ */
+size_t CommandHandler::GetStep(const CaptureCommand& capture)
+{
+    return capture.step;
+}
+
+/**
+ * @brief Queues each command of the list in the edge queues of its clock, at
+ * its first reference clock tick. A BOTH command is queued in both edges.
+ * 
+ * @param list 
+ * @param queues Edge queues of the command type: positive, then negative
+ * @param get_step Reference clock ticks between two runs of a command
+ * @param nested_variable_map 
+ */
+template <typename T>
+void CommandHandler::Queue(std::vector<T>& list, CommandQueue (ClockCommands::*queues)[2],
+                           size_t (*get_step)(const T&), HandlersMap& nested_variable_map)
+{
+    for (size_t index {0}; index < list.size(); index++)
+    {
+        T& command = list[index];
+        ClockCommands* commands = AddClockCommands(command.clock, nested_variable_map);
+        size_t next_tick = NextTick(command.begin, get_step(command), command.end, 0);
+
+        if (commands == nullptr || next_tick >= command.end)
+        {
+            continue;
+        }
+
+        /* Waveform logs stamp the samples with the edge time of their clock */
+        if constexpr (std::is_same_v<T, LogCommand>)
+        {
+            command.SetClock(commands->clock);
+        }
+
+        if (command.edge != T::NEGATIVE)
+        {
+            Schedule((commands->*queues)[0], next_tick, index);
+        }
+
+        if (command.edge != T::POSITIVE)
+        {
+            Schedule((commands->*queues)[1], next_tick, index);
+        }
+    }
+}
+
+/**
+ * @brief Appends the commands of the queue due at tick. The due list is only
+ * rebuilt when the tick changes: commands that keep running on the next tick
+ * stay in it, the rest go back to the heap and wait for their next tick.
+ * 
+ * @param queue 
+ * @param list 
+ * @param tick 
+ * @param output 
+ */
+template <typename T>
+void CommandHandler::Collect(CommandQueue& queue, std::vector<T>& list, unsigned long long tick,
+                             std::vector<T*>& output)
+{
+    auto later = [](const Entry& a, const Entry& b) { return a.next_tick > b.next_tick; };
+
+    if (!queue.is_due_valid || queue.due_tick != tick)
+    {
+        queue.next_due.clear();
+
+        /* Commands due on the last tick */
+        for (size_t index : queue.due)
         {
-            if (log.clock == clk_name
-                && (log.edge == 'b' || log.edge == clk_edge)
-                && log.end > ref_clock_tick
-                && log.begin <= ref_clock_tick
-                && (ref_clock_tick % log.step == 0))
+            T& command = list[index];
+            size_t next_tick = NextTick(command.begin, GetStep(command), command.end, tick);
+
+            if (next_tick >= command.end)
+            {
+                continue;
+            }
+
+            if (next_tick == tick)
             {
-                logs.push_back(&log);
+                queue.next_due.push_back(index);
+            }
+            else
+            {
+                Schedule(queue, next_tick, index);
             }
         }
 
-        /* Add log commands to next_sets list */
-        for (SetCommand& set : set_list)
+        /* Commands waiting for this tick, or for a tick the clock skipped */
+        bool is_sorted = true;
+        while (!queue.heap.empty() && queue.heap.front().next_tick <= tick)
         {
-            if (set.clock == clk_name
-                && set.edge == clk_edge
-                && set.end > ref_clock_tick
-                && set.begin <= ref_clock_tick)
+            std::pop_heap(queue.heap.begin(), queue.heap.end(), later);
+            Entry entry = queue.heap.back();
+            queue.heap.pop_back();
+
+            T& command = list[entry.index];
+            size_t next_tick = (entry.next_tick == tick)
+                             ? entry.next_tick
+                             : NextTick(command.begin, GetStep(command), command.end, tick);
+
+            if (next_tick >= command.end)
             {
-                sets.push_back(&set);
+                continue;
             }
+
+            if (next_tick == tick)
+            {
+                queue.next_due.push_back(entry.index);
+                is_sorted = false;
+            }
+            else
+            {
+                Schedule(queue, next_tick, entry.index);
+            }
+        }
+
+        /* Command file order */
+        if (!is_sorted)
+        {
+            std::sort(queue.next_due.begin(), queue.next_due.end());
         }
+
+        std::swap(queue.due, queue.next_due);
+        queue.due_tick = tick;
+        queue.is_due_valid = true;
+    }
+
+    for (size_t index : queue.due)
+    {
+        output.push_back(&list[index]);
     }
 }
 
@@ -272,4 +696,78 @@ void CommandHandler::Terminate()
     {
         flogs.push_back(&flog);
     }
+
+    /* Write statistics */
+    stats.clear();
+    for (auto &stat : stat_list)
+    {
+        stats.push_back(&stat);
+    }
+
+    /* Close captures */
+    captures.clear();
+    for (auto &capture : capture_list)
+    {
+        captures.push_back(&capture);
+    }
+}
+
+/**
+ * @brief Set commands loaded from the cmd file
+ * 
+ * @return const std::vector<SetCommand>& 
+ */
+const std::vector<SetCommand>& CommandHandler::GetSetCommands() const
+{
+    return set_list;
+}
+
+/**
+ * @brief Set commands loaded from the cmd file
+ * 
+ * @return std::vector<SetCommand>& 
+ */
+std::vector<SetCommand>& CommandHandler::GetSetCommands()
+{
+    return set_list;
+}
+
+/**
+ * @brief Log commands loaded from the cmd file
+ * 
+ * @return const std::vector<LogCommand>& 
+ */
+const std::vector<LogCommand>& CommandHandler::GetLogCommands() const
+{
+    return log_list;
+}
+
+/**
+ * @brief Log commands loaded from the cmd file
+ * 
+ * @return std::vector<LogCommand>& 
+ */
+std::vector<LogCommand>& CommandHandler::GetLogCommands()
+{
+    return log_list;
+}
+
+/**
+ * @brief Stat commands loaded from the cmd file
+ * 
+ * @return const std::vector<StatCommand>& 
+ */
+const std::vector<StatCommand>& CommandHandler::GetStatCommands() const
+{
+    return stat_list;
+}
+
+/**
+ * @brief Capture commands loaded from the cmd file
+ * 
+ * @return const std::vector<CaptureCommand>& 
+ */
+const std::vector<CaptureCommand>& CommandHandler::GetCaptureCommands() const
+{
+    return capture_list;
 }
\ No newline at end of file
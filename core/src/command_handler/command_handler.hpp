@@ -42,7 +42,7 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
-#include <deque>
+#include <cstddef>
 #include <fstream>
 #include <string>
 #include <vector>
@@ -56,6 +56,9 @@
 #include "set_command.hpp"
 #include "log_command.hpp"
 #include "final_log_command.hpp"
+#include "stat_command.hpp"
+#include "capture_command.hpp"
+#include "signal_index.hpp"
 
 /*******************************************************************************
 * COMMAND HANDLER CLASS
@@ -72,20 +75,89 @@ private:
     std::ifstream OpenFile(std::string& file_name);
     void LoadCommands(std::ifstream& file_handler);
     void LoadSignals(HandlersMap& nested_variable_map);
+    void ExpandSignals(const HandlersMap& nested_variable_map);
+    void LoadClocks(HandlersMap& nested_variable_map);
 
     std::vector<SetCommand> set_list;
     std::vector<LogCommand> log_list;
     std::vector<FinalLogCommand> flog_list;
+    std::vector<StatCommand> stat_list;
+    std::vector<CaptureCommand> capture_list;
+
+    /* Command waiting for its next reference clock tick */
+    struct Entry
+    {
+        size_t next_tick;
+        size_t index;
+    };
+
+    /* Commands of one clock edge, the due ones in command file order */
+    struct CommandQueue
+    {
+        std::vector<Entry> heap;
+        std::vector<size_t> due;
+        std::vector<size_t> next_due;
+        unsigned long long due_tick { 0 };
+        bool is_due_valid { false };
+    };
+
+    /* Commands of one clock, by edge */
+    struct ClockCommands
+    {
+        const Clock* clock;
+        CommandQueue logs[2];
+        CommandQueue sets[2];
+        CommandQueue stats[2];
+        CommandQueue captures[2];
+    };
+
+    std::vector<ClockCommands> clock_commands;
+
+    ClockCommands* FindClockCommands(const Clock* clock);
+    ClockCommands* AddClockCommands(const std::string& name, HandlersMap& nested_variable_map);
+    static size_t NextTick(size_t begin, size_t step, size_t end, unsigned long long tick);
+    static void Schedule(CommandQueue& queue, size_t next_tick, size_t index);
+    static size_t GetStep(const LogCommand& log);
+    static size_t GetStep(const SetCommand& set);
+    static size_t GetStep(const StatCommand& stat);
+    static size_t GetStep(const CaptureCommand& capture);
+
+    template <typename T>
+    static bool HasPatterns(const std::vector<T>& list);
+    template <typename T>
+    static void Expand(std::vector<T>& list, const SignalIndex& index);
+    template <typename T>
+    void Queue(std::vector<T>& list, CommandQueue (ClockCommands::*queues)[2],
+               size_t (*get_step)(const T&), HandlersMap& nested_variable_map);
+    template <typename T>
+    static void Collect(CommandQueue& queue, std::vector<T>& list, unsigned long long tick,
+                        std::vector<T*>& output);
 
 public:
 
     void Init(std::string& file_name, HandlersMap nested_variable_map);
-    void Run(std::deque<Clock*>& next_clocks);
+    void Run(std::vector<Clock*>& next_clocks);
+    void Run(std::vector<Clock*>& next_clocks, unsigned long long ref_clock_tick,
+             std::vector<SetCommand*>& next_sets, std::vector<LogCommand*>& next_logs,
+             std::vector<StatCommand*>& next_stats, std::vector<CaptureCommand*>& next_captures);
     void Terminate();
 
+    /* Loaded commands */
+    const std::vector<SetCommand>& GetSetCommands() const;
+    std::vector<SetCommand>& GetSetCommands();
+    const std::vector<LogCommand>& GetLogCommands() const;
+    std::vector<LogCommand>& GetLogCommands();
+    const std::vector<StatCommand>& GetStatCommands() const;
+    const std::vector<CaptureCommand>& GetCaptureCommands() const;
+
     std::vector<SetCommand*> sets;
     std::vector<LogCommand*> logs;
     std::vector<FinalLogCommand*> flogs;
+    std::vector<StatCommand*> stats;
+    std::vector<CaptureCommand*> captures;
+
+    /* Reference clock tick of the last run */
+    unsigned long long tick { 0 };
 
     Input<Clock> i_reference_clock;
 };
\ No newline at end of file
@@ -0,0 +1,251 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <cctype>
+#include <regex>
+#include <stdexcept>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "signal_index.hpp"
+
+/*******************************************************************************
+* SIGNAL INDEX CLASS
+********************************************************************************/
+
+/**
+ * @brief SignalIndex Constructor
+ *
+ * @param nested_variable_map Map with the reference of each reflected signal.
+ */
+SignalIndex::SignalIndex(const HandlersMap& nested_variable_map)
+{
+    names.reserve(nested_variable_map.size());
+
+    for (const auto& pair : nested_variable_map)
+    {
+        names.push_back(pair.first);
+    }
+
+    std::sort(names.begin(), names.end());
+}
+
+/**
+ * @brief The signal name is a glob or a regular expression
+ *
+ * @param signal
+ * @return bool
+ */
+bool SignalIndex::IsPattern(const std::string& signal)
+{
+    return signal.starts_with("re:") || signal.find_first_of("*?[") != std::string::npos;
+}
+
+/**
+ * @brief Names matching the pattern, sorted
+ *
+ * @param pattern
+ * @return std::vector<std::string>
+ */
+std::vector<std::string> SignalIndex::Find(const std::string& pattern) const
+{
+    bool is_regex = pattern.starts_with("re:");
+    std::string_view expression = std::string_view(pattern).substr(is_regex ? 3 : 0);
+    std::string prefix = is_regex ? GetRegexPrefix(expression) : GetGlobPrefix(expression);
+
+    std::regex regex;
+
+    if (is_regex)
+    {
+        try
+        {
+            regex = std::regex(expression.begin(), expression.end());
+        }
+        catch (const std::regex_error& e)
+        {
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [invalid pattern]: "
+                                   + pattern + ": " + e.what();
+
+            throw std::runtime_error(error_text);
+        }
+    }
+
+    /* Only the names with the literal prefix can match */
+    std::vector<std::string> matches;
+    auto it = std::lower_bound(names.begin(), names.end(), prefix);
+
+    for (; it != names.end() && it->starts_with(prefix); ++it)
+    {
+        if (is_regex ? std::regex_match(*it, regex) : MatchGlob(expression, *it))
+        {
+            matches.push_back(*it);
+        }
+    }
+
+    return matches;
+}
+
+bool SignalIndex::MatchGlob(std::string_view pattern, std::string_view name)
+{
+    while (!pattern.empty())
+    {
+        /* * inside one level, ** across levels */
+        if (pattern[0] == '*')
+        {
+            bool is_any_level = pattern.starts_with("**");
+            std::string_view rest = pattern.substr(is_any_level ? 2 : 1);
+
+            for (size_t i = 0; i <= name.size(); i++)
+            {
+                if (MatchGlob(rest, name.substr(i)))
+                {
+                    return true;
+                }
+
+                if (i < name.size() && name[i] == '.' && !is_any_level)
+                {
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        if (name.empty())
+        {
+            return false;
+        }
+
+        if (pattern[0] == '?')
+        {
+            if (name[0] == '.')
+            {
+                return false;
+            }
+            pattern.remove_prefix(1);
+        }
+        else if (pattern[0] == '[' && pattern.find(']') != std::string_view::npos)
+        {
+            /* [abc], [a-z] or negated [!abc] */
+            size_t close = pattern.find(']');
+            std::string_view set = pattern.substr(1, close - 1);
+            bool is_negated = !set.empty() && (set[0] == '!' || set[0] == '^');
+            bool is_found = false;
+
+            for (size_t i = is_negated ? 1 : 0; i < set.size(); i++)
+            {
+                if (i + 2 < set.size() && set[i + 1] == '-')
+                {
+                    is_found |= (set[i] <= name[0] && name[0] <= set[i + 2]);
+                    i += 2;
+                }
+                else
+                {
+                    is_found |= (set[i] == name[0]);
+                }
+            }
+
+            if (is_found == is_negated)
+            {
+                return false;
+            }
+            pattern.remove_prefix(close + 1);
+        }
+        else
+        {
+            if (pattern[0] != name[0])
+            {
+                return false;
+            }
+            pattern.remove_prefix(1);
+        }
+
+        name.remove_prefix(1);
+    }
+
+    return name.empty();
+}
+
+std::string SignalIndex::GetGlobPrefix(std::string_view pattern)
+{
+    return std::string(pattern.substr(0, pattern.find_first_of("*?[")));
+}
+
+std::string SignalIndex::GetRegexPrefix(std::string_view expression)
+{
+    /* An alternative could start anywhere */
+    if (expression.find('|') != std::string_view::npos)
+    {
+        return "";
+    }
+
+    std::string prefix;
+
+    for (size_t i = 0; i < expression.size(); i++)
+    {
+        char c = expression[i];
+
+        /* Escaped punctuation is literal, \d, \w... are not */
+        if (c == '\\' && i + 1 < expression.size() && std::ispunct(static_cast<unsigned char>(expression[i + 1])))
+        {
+            c = expression[++i];
+        }
+        else if (c == '\\' || std::string_view(".[](){}*+?^$").find(c) != std::string_view::npos)
+        {
+            break;
+        }
+
+        /* A quantifier makes the last character optional */
+        if (i + 1 < expression.size() && std::string_view("*?{").find(expression[i + 1]) != std::string_view::npos)
+        {
+            break;
+        }
+
+        prefix += c;
+    }
+
+    return prefix;
+}
@@ -0,0 +1,645 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "domain_scheduler.hpp"
+#include "command_handler.hpp"
+#include "logger.hpp"
+#include "setter.hpp"
+
+/*******************************************************************************
+* DOMAIN SCHEDULER CLASS
+********************************************************************************/
+
+DomainScheduler::~DomainScheduler()
+{
+    stop.store(true);
+    generation.fetch_add(1, std::memory_order_release);
+    generation.notify_all();
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Split the clocks into domains and decouple the ports between them.
+ * With a single domain nothing is done and the Scheduler runs the clocks.
+ * 
+ * @param top Top module of the hierarchy
+ * @param ref_clock Reference clock: the domains meet at each of its edges
+ * @param clocks Clocks of the simulator, in construction order
+ * @param handler 
+ * @param set 
+ * @param log 
+ * @param replay Hyper-period replay in each domain
+ * @param n_threads Threads for the masters of each domain
+ * @param combinational_order Fully combinational modules to settle
+ */
+void DomainScheduler::Init(Module& top, Clock& ref_clock, const std::vector<Clock*>& clocks,
+                           CommandHandler& handler, Setter& set, Logger& log,
+                           bool replay, size_t n_threads, const std::vector<Module*>& combinational_order)
+{
+    cmd_handler = &handler;
+    setter = &set;
+    logger = &log;
+    reference_clock = &ref_clock;
+
+    /* Clock trees */
+    DomainsMap module_domains;
+    Partition(clocks, module_domains);
+
+    if (domains.size() < 2)
+    {
+        domains.clear();
+        return;
+    }
+
+    /* Combinational modules are settled by the domain that reads them */
+    for (Module* module : combinational_order)
+    {
+        auto [it, inserted] = module_domains.try_emplace(module, domains.front().get());
+        it->second->combinational_modules.push_back(module);
+    }
+
+    CheckCommands(top, module_domains);
+    Decouple(top, module_domains);
+
+    /* Domain schedulers: combinational modules are settled here */
+    for (auto &domain : domains)
+    {
+        domain->scheduler.Init(domain->clocks, replay, n_threads, {});
+        domain->sets.reserve(cmd_handler->GetSetCommands().size());
+        domain->logs.reserve(cmd_handler->GetLogCommands().size());
+        domain->stats.reserve(cmd_handler->GetStatCommands().size());
+        domain->captures.reserve(cmd_handler->GetCaptureCommands().size());
+        Settle(*domain);
+    }
+
+    /* The calling thread runs the reference domain */
+    for (size_t i {1}; i < domains.size(); i++)
+    {
+        workers.emplace_back(&DomainScheduler::Worker, this, domains[i].get());
+    }
+}
+
+/**
+ * @brief Run every edge up to the next edge of the reference clock, and
+ * wait for all the domains.
+ * 
+ */
+void DomainScheduler::RunWindow()
+{
+    Ticks end = reference_clock->GetNextEdgeTicks();
+    reference_tick = reference_clock->GetTickCount();
+
+    do
+    {
+        horizon = (end - window_start > MAX_WINDOW) ? window_start + MAX_WINDOW : end;
+
+        /* Workers are parked: watermarks restart from the window start */
+        for (auto &domain : domains)
+        {
+            domain->watermark.store(ToOffset(domain->scheduler.PeekNextEdgeTicks()), std::memory_order_relaxed);
+        }
+
+        n_finished.store(0, std::memory_order_relaxed);
+        generation.fetch_add(1, std::memory_order_release);
+        generation.notify_all();
+
+        Run(*domains.front());
+
+        /* Barrier */
+        while (n_finished.load(std::memory_order_acquire) != workers.size())
+        {
+            std::this_thread::yield();
+        }
+
+        if (failed.load())
+        {
+            std::rethrow_exception(error);
+        }
+
+        window_start = horizon;
+    } while (horizon < end);
+}
+
+size_t DomainScheduler::GetDomainCount() const
+{
+    return domains.size();
+}
+
+/**
+ * @brief One domain per clock tree. The reference domain goes first.
+ * 
+ * @param clocks Clocks of the simulator, in construction order
+ * @param module_domains Domain of each clock and of each module they run
+ */
+void DomainScheduler::Partition(const std::vector<Clock*>& clocks, DomainsMap& module_domains)
+{
+    std::unordered_set<const Clock*> derived;
+
+    for (Clock* clock : clocks)
+    {
+        derived.insert(clock->derived_clocks.begin(), clock->derived_clocks.end());
+    }
+
+    for (Clock* root : clocks)
+    {
+        if (derived.count(root))
+        {
+            continue;
+        }
+
+        /* Clock tree, in the order of construction */
+        std::unordered_set<const Clock*> tree {root};
+        std::vector<Clock*> pending {root};
+
+        while (!pending.empty())
+        {
+            Clock* clock = pending.back();
+            pending.pop_back();
+
+            for (Clock* derived_clock : clock->derived_clocks)
+            {
+                tree.insert(derived_clock);
+                pending.push_back(derived_clock);
+            }
+        }
+
+        auto domain = std::make_unique<Domain>();
+
+        for (Clock* clock : clocks)
+        {
+            if (tree.count(clock))
+            {
+                domain->clocks.push_back(clock);
+                module_domains[clock] = domain.get();
+            }
+        }
+
+        /* Modules and the combinational modules they read */
+        for (Clock* clock : domain->clocks)
+        {
+            for (Module* module : clock->master_order)
+            {
+                auto [it, inserted] = module_domains.try_emplace(module, domain.get());
+
+                if (it->second != domain.get())
+                {
+                    std::string error_text = std::string(__FILE__) + ":"
+                                           + std::to_string(__LINE__) + ": "
+                                           + "ERROR [module shared by clock domains]: "
+                                           + module->GetFullName();
+                    throw std::runtime_error(error_text);
+                }
+            }
+        }
+
+        /* The domain of the reference clock goes first */
+        domains.push_back(std::move(domain));
+
+        if (tree.count(reference_clock))
+        {
+            std::rotate(domains.begin(), domains.end() - 1, domains.end());
+        }
+    }
+}
+
+/**
+ * @brief Decouple the ports reading a signal of another domain. The signal
+ * belongs to the module whose port points to it directly.
+ * 
+ * @param top 
+ * @param module_domains 
+ */
+void DomainScheduler::Decouple(Module& top, DomainsMap& module_domains)
+{
+    std::vector<Module*> modules;
+    top.GetModules(modules);
+
+    /* Links of each module and owner of each signal */
+    std::vector<std::vector<PortLink>> links(modules.size());
+    std::unordered_map<const void*, Module*> owners;
+
+    for (size_t i {0}; i < modules.size(); i++)
+    {
+        std::vector<AbstractPort*> port_ptrs;
+        modules[i]->GetPorts(port_ptrs);
+
+        for (AbstractPort* port : port_ptrs)
+        {
+            port->GetLinks(links[i]);
+        }
+
+        for (const PortLink& link : links[i])
+        {
+            if (link.is_linked || link.data == nullptr)
+            {
+                continue;
+            }
+
+            /* Signals of several modules have no owner */
+            auto [it, inserted] = owners.try_emplace(link.data, modules[i]);
+
+            if (it->second != modules[i])
+            {
+                it->second = nullptr;
+            }
+        }
+    }
+
+    for (size_t i {0}; i < modules.size(); i++)
+    {
+        auto consumer = module_domains.find(modules[i]);
+
+        if (consumer == module_domains.end())
+        {
+            continue;
+        }
+
+        for (const PortLink& link : links[i])
+        {
+            auto owner = owners.find(link.data);
+
+            if (!link.is_linked || owner == owners.end() || owner->second == nullptr)
+            {
+                continue;
+            }
+
+            auto producer = module_domains.find(owner->second);
+
+            if (producer == module_domains.end() || producer->second == consumer->second)
+            {
+                continue;
+            }
+
+            std::unique_ptr<AbstractChannel> channel = link.port->Decouple(CHANNEL_CAPACITY);
+
+            if (channel == nullptr)
+            {
+                continue;
+            }
+
+            Domain* consumer_domain = consumer->second;
+            Domain* producer_domain = producer->second;
+
+            producer_domain->outputs.push_back(channel.get());
+            consumer_domain->inputs.push_back(channel.get());
+            channels.push_back(std::move(channel));
+
+            auto &producers = consumer_domain->producers;
+            if (std::find(producers.begin(), producers.end(), producer_domain) == producers.end())
+            {
+                producers.push_back(producer_domain);
+            }
+        }
+    }
+}
+
+/**
+ * @brief A command runs on the thread of its clock: it can not touch the
+ * signals of another domain. SET commands must target a domain signal.
+ * 
+ * @param top 
+ * @param module_domains 
+ */
+void DomainScheduler::CheckCommands(Module& top, DomainsMap& module_domains)
+{
+    /* Domain of each module and clock name */
+    NamesMap names;
+
+    std::vector<Module*> modules;
+    top.GetModules(modules);
+
+    for (Module* module : modules)
+    {
+        auto it = module_domains.find(module);
+        names[module->GetFullName()] = (it != module_domains.end()) ? it->second : nullptr;
+    }
+
+    for (auto &domain : domains)
+    {
+        for (Clock* clock : domain->clocks)
+        {
+            names[clock->GetFullName()] = domain.get();
+        }
+    }
+
+    auto check = [&names](const std::string& signal, const std::string& clock, bool is_set)
+    {
+        auto clock_domain = names.find(clock);
+
+        if (clock_domain == names.end() || clock_domain->second == nullptr)
+        {
+            return;
+        }
+
+        Domain* signal_domain = FindDomain(signal, names);
+
+        if (signal_domain == clock_domain->second || (signal_domain == nullptr && !is_set))
+        {
+            return;
+        }
+
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [command across clock domains]: "
+                               + signal + " on " + clock;
+        throw std::runtime_error(error_text);
+    };
+
+    for (const LogCommand& log : cmd_handler->GetLogCommands())
+    {
+        check(log.signal, log.clock, false);
+    }
+
+    for (const SetCommand& set : cmd_handler->GetSetCommands())
+    {
+        check(set.signal, set.clock, true);
+    }
+
+    for (const StatCommand& stat : cmd_handler->GetStatCommands())
+    {
+        check(stat.signal, stat.clock, false);
+    }
+
+    for (const CaptureCommand& capture : cmd_handler->GetCaptureCommands())
+    {
+        check(capture.signal, capture.clock, false);
+        check(capture.trigger, capture.clock, false);
+    }
+}
+
+/**
+ * @brief Domain of the deepest module or clock in a hierarchical name
+ * 
+ * @param name 
+ * @param names 
+ */
+DomainScheduler::Domain* DomainScheduler::FindDomain(std::string name, const NamesMap& names)
+{
+    while (true)
+    {
+        auto it = names.find(name);
+
+        if (it != names.end())
+        {
+            return it->second;
+        }
+
+        size_t pos = name.rfind('.');
+
+        if (pos == std::string::npos)
+        {
+            return nullptr;
+        }
+
+        name.resize(pos);
+    }
+}
+
+void DomainScheduler::Worker(Domain* domain)
+{
+    unsigned long seen { 0 };
+
+    while (true)
+    {
+        /* Spin briefly, then sleep until the next window */
+        for (unsigned int i {0}; i < SPIN_COUNT && generation.load(std::memory_order_acquire) == seen; i++)
+        {
+            std::this_thread::yield();
+        }
+
+        generation.wait(seen, std::memory_order_acquire);
+        seen = generation.load(std::memory_order_acquire);
+
+        if (stop.load())
+        {
+            return;
+        }
+
+        Run(*domain);
+        n_finished.fetch_add(1, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Run the edges of the window. The first error stops every domain
+ * and is thrown again by RunWindow().
+ * 
+ * @param domain 
+ */
+void DomainScheduler::Run(Domain& domain)
+{
+    try
+    {
+        RunEdges(domain);
+    }
+    catch (...)
+    {
+        if (!failed.exchange(true))
+        {
+            error = std::current_exception();
+        }
+    }
+}
+
+void DomainScheduler::RunEdges(Domain& domain)
+{
+    Scheduler &scheduler = domain.scheduler;
+
+    for (Ticks time = scheduler.PeekNextEdgeTicks(); time <= horizon; time = scheduler.PeekNextEdgeTicks())
+    {
+        Offset offset = ToOffset(time);
+
+        /* Inputs published before the edge */
+        if (!WaitProducers(domain, offset, time))
+        {
+            return;
+        }
+
+        /* Edge */
+        scheduler.UpdateNextClocks();
+        cmd_handler->Run(scheduler.next_clocks, reference_tick, domain.sets, domain.logs, domain.stats,
+                         domain.captures);
+
+        if (domain.sets.size())
+        {
+            setter->Run(domain.sets);
+        }
+
+        scheduler.RunClocks();
+
+        /* Outputs: the registers of the edge are final */
+        if (!Publish(domain, time))
+        {
+            return;
+        }
+
+        domain.watermark.store(offset + 1, std::memory_order_release);
+
+        /* Combinational outputs and logs see the inputs of the edge too */
+        if (!domain.inputs.empty())
+        {
+            if (!WaitProducers(domain, offset + 1, time + 1))
+            {
+                return;
+            }
+        }
+
+        Settle(domain);
+
+        if (domain.logs.size())
+        {
+            logger->Run(domain.logs);
+        }
+
+        if (domain.stats.size())
+        {
+            logger->Run(domain.stats);
+        }
+
+        if (domain.captures.size())
+        {
+            logger->Run(domain.captures, reference_tick);
+        }
+
+        domain.watermark.store(ToOffset(scheduler.PeekNextEdgeTicks()), std::memory_order_release);
+    }
+
+    /* Window end: inputs up to the reference edge, as seen by the user methods */
+    if (!domain.inputs.empty())
+    {
+        if (!WaitProducers(domain, ToOffset(horizon) + 1, horizon + 1))
+        {
+            return;
+        }
+
+        Settle(domain);
+    }
+}
+
+/**
+ * @brief Wait until the producers are done with every edge before offset and
+ * consume the inputs published before time. A fast producer can fill a
+ * channel before reaching the watermark, so the inputs are drained while
+ * waiting: the samples before time would be consumed anyway.
+ * 
+ * @param domain 
+ * @param offset Watermark of the producers
+ * @param time Inputs published before this time
+ */
+bool DomainScheduler::WaitProducers(Domain& domain, Offset offset, Ticks time)
+{
+    for (Domain* producer : domain.producers)
+    {
+        while (producer->watermark.load(std::memory_order_acquire) < offset)
+        {
+            if (failed.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            for (AbstractChannel* channel : domain.inputs)
+            {
+                channel->Consume(time);
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    for (AbstractChannel* channel : domain.inputs)
+    {
+        channel->Consume(time);
+    }
+
+    return true;
+}
+
+bool DomainScheduler::Publish(Domain& domain, Ticks time)
+{
+    for (AbstractChannel* channel : domain.outputs)
+    {
+        /* Full: the consumer drains it while it waits for this domain */
+        while (!channel->Publish(time))
+        {
+            if (failed.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    return true;
+}
+
+void DomainScheduler::Settle(Domain& domain)
+{
+    for (Module* module : domain.combinational_modules)
+    {
+        module->RunClockMaster();
+    }
+}
+
+DomainScheduler::Offset DomainScheduler::ToOffset(Ticks time) const
+{
+    if (time <= window_start)
+    {
+        return 0;
+    }
+
+    Ticks offset = time - window_start;
+    return (offset > MAX_WINDOW) ? std::numeric_limits<Offset>::max() : static_cast<Offset>(offset);
+}
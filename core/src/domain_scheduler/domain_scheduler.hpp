@@ -0,0 +1,179 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "abstract_channel.hpp"
+#include "clock.hpp"
+#include "log_command.hpp"
+#include "module.hpp"
+#include "scheduler.hpp"
+#include "set_command.hpp"
+#include "stat_command.hpp"
+#include "capture_command.hpp"
+
+/*******************************************************************************
+* FORWARD DECLARATIONS
+********************************************************************************/
+
+class CommandHandler;
+class Logger;
+class Setter;
+
+/*******************************************************************************
+* DOMAIN SCHEDULER CLASS
+********************************************************************************/
+
+/**
+ * @brief Runs each clock domain (an independent clock and its derived clocks)
+ * on its own thread.
+ * 
+ * A port reading a signal of another domain is decoupled through a bounded
+ * SPSC channel: the producer publishes the value after each of its edges and
+ * the consumer sees the values published before its own edge, as a register
+ * would. A domain only runs an edge once its producers are done with every
+ * earlier edge (its watermark), so time stays causal and the results do not
+ * depend on the thread timing.
+ * 
+ * All the domains meet at each edge of the reference clock, where the user
+ * methods Iteration() and ContinueRunning() see a consistent state.
+ */
+class DomainScheduler
+{
+private:
+
+    using Ticks = Clock::Ticks;
+
+    static constexpr size_t CHANNEL_CAPACITY { 1024 };
+    static constexpr unsigned int SPIN_COUNT { 4096 };
+
+    /* Watermarks are offsets from the window start */
+    using Offset = unsigned long long;
+    static constexpr Offset MAX_WINDOW { std::numeric_limits<Offset>::max() - 1 };
+
+    struct Domain
+    {
+        /* Clock tree and its modules */
+        std::vector<Clock*> clocks;
+        std::vector<Module*> combinational_modules;
+        Scheduler scheduler;
+
+        /* Boundary channels and the domains feeding them */
+        std::vector<AbstractChannel*> inputs;
+        std::vector<AbstractChannel*> outputs;
+        std::vector<Domain*> producers;
+
+        /* Commands of the current edge */
+        std::vector<SetCommand*> sets;
+        std::vector<LogCommand*> logs;
+        std::vector<StatCommand*> stats;
+        std::vector<CaptureCommand*> captures;
+
+        /* Every edge before window_start + watermark is done */
+        alignas(64) std::atomic<Offset> watermark { 0 };
+    };
+
+    using DomainsMap = std::unordered_map<const void*, Domain*>;
+    using NamesMap = std::unordered_map<std::string, Domain*>;
+
+    std::vector<std::unique_ptr<Domain>> domains;
+    std::vector<std::unique_ptr<AbstractChannel>> channels;
+    std::vector<std::thread> workers;
+
+    /* Simulator core */
+    CommandHandler* cmd_handler { nullptr };
+    Setter* setter { nullptr };
+    Logger* logger { nullptr };
+    Clock* reference_clock { nullptr };
+
+    /* Current window: edges in (window_start, horizon] */
+    Ticks window_start { 0 };
+    Ticks horizon { 0 };
+    unsigned long long reference_tick { 0 };
+
+    /* Worker wake-up */
+    std::atomic<unsigned long> generation { 0 };
+    std::atomic<size_t> n_finished { 0 };
+    std::atomic<bool> stop { false };
+    std::atomic<bool> failed { false };
+    std::exception_ptr error;
+
+    /* Partition */
+    void Partition(const std::vector<Clock*>& clocks, DomainsMap& module_domains);
+    void Decouple(Module& top, DomainsMap& module_domains);
+    void CheckCommands(Module& top, DomainsMap& module_domains);
+    static Domain* FindDomain(std::string name, const NamesMap& names);
+
+    /* Execution */
+    void Worker(Domain* domain);
+    void Run(Domain& domain);
+    void RunEdges(Domain& domain);
+    bool WaitProducers(Domain& domain, Offset offset, Ticks time);
+    bool Publish(Domain& domain, Ticks time);
+    void Settle(Domain& domain);
+    Offset ToOffset(Ticks time) const;
+
+public:
+
+    DomainScheduler() = default;
+    ~DomainScheduler();
+
+    void Init(Module& top, Clock& ref_clock, const std::vector<Clock*>& clocks,
+              CommandHandler& handler, Setter& set, Logger& log,
+              bool replay, size_t n_threads, const std::vector<Module*>& combinational_order);
+    void RunWindow();
+    size_t GetDomainCount() const;
+};
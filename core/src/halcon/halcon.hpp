@@ -42,8 +42,10 @@
 * LOCAL HEADERS
 ********************************************************************************/
 
+#include "checkpoint.hpp"
 #include "clock.hpp"
 #include "module.hpp"
 #include "port.hpp"
+#include "random_stream.hpp"
 #include "register.hpp"
 #include "simulator.hpp"
\ No newline at end of file
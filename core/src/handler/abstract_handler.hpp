@@ -42,6 +42,7 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <cstdint>
 #include <sstream>
 #include <string>
 
@@ -64,14 +65,31 @@ public:
     virtual std::string GetNBytesAsString() = 0;
     virtual std::string GetSizeAsString() = 0;
 
+    /* Set and Get in binary */
+    virtual size_t GetValueBytes() = 0;
+    virtual void GetValue(void* memory) = 0;
+    virtual void SetValue(const void* memory) = 0;
+
     /* Buffer commands */
     virtual void CreateBuffer(size_t size) = 0;
     virtual void DeleteBuffer() = 0;
+    virtual void AttachBuffer(void* memory, size_t size) = 0;
     virtual void SaveSample() = 0;
-    virtual void FlushToBinaryFile(std::ofstream& file) = 0;
-    virtual void FlushToTextFile(std::ofstream& file, char format) = 0;
+    virtual void FlushToBinaryFile(std::ostream& file) = 0;
+    virtual void FlushToTextFile(std::ostream& file, char format) = 0;
 
     /* Buffer information */
     virtual bool BufferIsFull() = 0;
     virtual bool IsBufferCreated() = 0;
+    virtual size_t GetSampleBytes() = 0;
+
+    /* Sample values */
+    virtual size_t GetValueCount() = 0;
+    virtual void GetValues(double* values) = 0;
+    virtual void CopySample(void* memory) = 0;
+    virtual void SetSample(const void* memory) = 0;
+
+    /* Waveform values */
+    virtual size_t GetBitWidth() = 0;
+    virtual void GetBits(uint64_t* values) = 0;
 };
\ No newline at end of file
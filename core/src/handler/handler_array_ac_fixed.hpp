@@ -94,16 +94,33 @@ public:
     std::string GetNBytesAsString() override;
     std::string GetSizeAsString() override;
 
+    /* Set and Get in binary */
+    size_t GetValueBytes() override;
+    void GetValue(void* memory) override;
+    void SetValue(const void* memory) override;
+
     /* Buffer commands */
     void CreateBuffer(size_t size) override;
     void DeleteBuffer() override;
+    void AttachBuffer(void* memory, size_t size) override;
     void SaveSample() override;
-    void FlushToBinaryFile(std::ofstream& file) override;
-    void FlushToTextFile(std::ofstream& file, char format) override;
+    void FlushToBinaryFile(std::ostream& file) override;
+    void FlushToTextFile(std::ostream& file, char format) override;
 
     /* Buffer information */
     bool BufferIsFull() override;
     bool IsBufferCreated() override;
+    size_t GetSampleBytes() override;
+
+    /* Sample values */
+    size_t GetValueCount() override;
+    void GetValues(double* values) override;
+    void CopySample(void* memory) override;
+    void SetSample(const void* memory) override;
+
+    /* Waveform values */
+    size_t GetBitWidth() override;
+    void GetBits(uint64_t* values) override;
 };
 
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
@@ -239,6 +256,148 @@ void Handler<ac_fixed_array<W, I, S, Q, O, N>>::CreateBuffer(size_t size)
     }
 }
 
+/**
+ * @brief Uses memory owned by the caller as the buffer, e.g. a mapped file.
+ *
+ * @param memory Room for size samples.
+ * @param size Size of the buffer.
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::AttachBuffer(void* memory, size_t size)
+{
+    buffer_size = size;
+    buffer_index = 0;
+    is_buffer_full = false;
+    buffer = std::shared_ptr<std::array<double, N>>(static_cast<std::array<double, N>*>(memory), [](std::array<double, N>*) {});
+}
+
+/**
+ * @brief Bytes of a buffered sample, as written to binary files.
+ *
+ * @return size_t
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+size_t Handler<ac_fixed_array<W, I, S, Q, O, N>>::GetSampleBytes()
+{
+    return sizeof(std::array<double, N>);
+}
+
+/**
+ * @brief Number of values of a sample.
+ *
+ * @return size_t
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+size_t Handler<ac_fixed_array<W, I, S, Q, O, N>>::GetValueCount()
+{
+    return N;
+}
+
+/**
+ * @brief Current value of the signal as doubles.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::GetValues(double* values)
+{
+    for (size_t i { 0 }; i < N; ++i)
+    {
+        values[i] = (data_ptr->data() + i)->to_double();
+    }
+}
+
+/**
+ * @brief Copies the current sample to memory, as it is stored in the buffer.
+ *
+ * @param memory Room for GetSampleBytes() bytes
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::CopySample(void* memory)
+{
+    std::array<double, N>& sample = *static_cast<std::array<double, N>*>(memory);
+
+    for (size_t i { 0 }; i < N; ++i)
+    {
+        sample[i] = (data_ptr->data() + i)->to_double();
+    }
+}
+
+/**
+ * @brief Sets the signal from a sample stored as in the buffer, e.g. read
+ * from a binary LOG file.
+ *
+ * @param memory Sample of GetSampleBytes() bytes
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::SetSample(const void* memory)
+{
+    const std::array<double, N>& sample = *static_cast<const std::array<double, N>*>(memory);
+
+    for (size_t i { 0 }; i < N; ++i)
+    {
+        *(data_ptr->data() + i) = sample[i];
+    }
+}
+
+/**
+ * @brief Bits of each value in a waveform, 0 when the values are real numbers.
+ *
+ * @return size_t
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+size_t Handler<ac_fixed_array<W, I, S, Q, O, N>>::GetBitWidth()
+{
+    return WaveformValue<ac_fixed<W, I, S, Q, O>>::WIDTH;
+}
+
+/**
+ * @brief Current value of the signal as waveform bits, see WaveformValue.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::GetBits(uint64_t* values)
+{
+    for (size_t i { 0 }; i < N; ++i)
+    {
+        values[i] = WaveformValue<ac_fixed<W, I, S, Q, O>>::GetBits(*(data_ptr->data() + i));
+    }
+}
+
+/**
+ * @brief Bytes of the value in binary, see GetValue and SetValue.
+ *
+ * @return size_t
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+size_t Handler<ac_fixed_array<W, I, S, Q, O, N>>::GetValueBytes()
+{
+    return sizeof(ac_fixed_array<W, I, S, Q, O, N>);
+}
+
+/**
+ * @brief Copies the value of the signal to memory, in its own type.
+ *
+ * @param memory Room for GetValueBytes() bytes
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::GetValue(void* memory)
+{
+    *static_cast<ac_fixed_array<W, I, S, Q, O, N>*>(memory) = *data_ptr;
+}
+
+/**
+ * @brief Sets the signal from a value copied by GetValue.
+ *
+ * @param memory Value of GetValueBytes() bytes
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::SetValue(const void* memory)
+{
+    *data_ptr = *static_cast<const ac_fixed_array<W, I, S, Q, O, N>*>(memory);
+}
+
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
 void Handler<ac_fixed_array<W, I, S, Q, O, N>>::DeleteBuffer()
 {
@@ -267,7 +426,7 @@ void Handler<ac_fixed_array<W, I, S, Q, O, N>>::SaveSample()
 }
 
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
-void Handler<ac_fixed_array<W, I, S, Q, O, N>>::FlushToBinaryFile(std::ofstream& file)
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::FlushToBinaryFile(std::ostream& file)
 {
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
@@ -280,68 +439,28 @@ void Handler<ac_fixed_array<W, I, S, Q, O, N>>::FlushToBinaryFile(std::ofstream&
 }
 
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
-void Handler<ac_fixed_array<W, I, S, Q, O, N>>::FlushToTextFile(std::ofstream& file, char format)
+void Handler<ac_fixed_array<W, I, S, Q, O, N>>::FlushToTextFile(std::ostream& file, char format)
 {
-    /* Avoid "unused" warning */
-    (void) format;
-
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
 
-    std::stringstream ss;
+    TextFormatter text(file, format);
     ac_fixed<W, I, S, Q, O> aux;
 
-    switch (format)
+    for (size_t i { 0 }; i < limit; i++)
     {
-        /* HEX */
-        case 'h':
-
-            ss.precision(std::numeric_limits<unsigned int>::digits10 + 1);
-
-            for (size_t i { 0 }; i < limit; i++)
-            {
-                for (size_t j { 0 }; j < N; j++)
-                {
-                    aux = buffer.get()[i][j];
-                    ss << std::hex << aux.to_uint() << '\t';
-                }
-                ss << '\n';
-            }
-            break;
-
-        /* UINT */
-        case 'i':
-            
-            ss.precision(std::numeric_limits<unsigned int>::digits10 + 1);
-
-            for (size_t i { 0 }; i < limit; i++)
-            {
-                for (size_t j { 0 }; j < N; j++)
-                {
-                    aux = buffer.get()[i][j];
-                    ss << aux.to_uint() << '\t';
-                }
-                ss << '\n';
-            }
-            break;
-
-        /* DOUBLE */
-        default:
-
-            ss.precision(std::numeric_limits<double>::digits10 + 1);
-
-            for (size_t i { 0 }; i < limit; i++)
+        for (size_t j { 0 }; j < N; j++)
+        {
+            if (j != 0)
             {
-                for (size_t j { 0 }; j < N; j++)
-                {
-                    ss << buffer.get()[i][j] << '\t';
-                }
-                ss << '\n';
+                text.Put(TextFormatter::ELEMENT_SEPARATOR);
             }
-            break;
+            aux = buffer.get()[i][j];
+            text.Append(aux);
+        }
+        text.Put(TextFormatter::SAMPLE_SEPARATOR);
     }
-
-    file << ss.str();
+    text.Flush();
 }
 
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O, size_t N>
@@ -92,16 +92,33 @@ public:
     std::string GetNBytesAsString() override;
     std::string GetSizeAsString() override;
 
+    /* Set and Get in binary */
+    size_t GetValueBytes() override;
+    void GetValue(void* memory) override;
+    void SetValue(const void* memory) override;
+
     /* Buffer commands */
     void CreateBuffer(size_t size) override;
     void DeleteBuffer() override;
+    void AttachBuffer(void* memory, size_t size) override;
     void SaveSample() override;
-    void FlushToBinaryFile(std::ofstream& file) override;
-    void FlushToTextFile(std::ofstream& file, char format) override;
+    void FlushToBinaryFile(std::ostream& file) override;
+    void FlushToTextFile(std::ostream& file, char format) override;
     
     /* Buffer information */
     bool BufferIsFull() override;
     bool IsBufferCreated() override;
+    size_t GetSampleBytes() override;
+
+    /* Sample values */
+    size_t GetValueCount() override;
+    void GetValues(double* values) override;
+    void CopySample(void* memory) override;
+    void SetSample(const void* memory) override;
+
+    /* Waveform values */
+    size_t GetBitWidth() override;
+    void GetBits(uint64_t* values) override;
 };
 
 /**
@@ -279,6 +296,141 @@ void Handler<std::array<std::complex<T>, N>>::CreateBuffer(size_t size)
     }
 }
 
+/**
+ * @brief Uses memory owned by the caller as the buffer, e.g. a mapped file.
+ *
+ * @param memory Room for size samples.
+ * @param size Size of the buffer.
+ */
+template <typename T, size_t N>
+void Handler<std::array<std::complex<T>, N>>::AttachBuffer(void* memory, size_t size)
+{
+    buffer_size = size;
+    buffer_index = 0;
+    is_buffer_full = false;
+    buffer = std::shared_ptr<std::array<std::complex<T>, N>>(static_cast<std::array<std::complex<T>, N>*>(memory), [](std::array<std::complex<T>, N>*) {});
+}
+
+/**
+ * @brief Bytes of a buffered sample, as written to binary files.
+ *
+ * @return size_t
+ */
+template <typename T, size_t N>
+size_t Handler<std::array<std::complex<T>, N>>::GetSampleBytes()
+{
+    return sizeof(std::array<std::complex<T>, N>);
+}
+
+/**
+ * @brief Number of values of a sample, complex elements count twice.
+ *
+ * @return size_t
+ */
+template <typename T, size_t N>
+size_t Handler<std::array<std::complex<T>, N>>::GetValueCount()
+{
+    return 2 * N;
+}
+
+/**
+ * @brief Current value of the signal as doubles, complex elements as real
+ * and imaginary parts.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template <typename T, size_t N>
+void Handler<std::array<std::complex<T>, N>>::GetValues(double* values)
+{
+    for (size_t i { 0 }; i < N; ++i)
+    {
+        values[2 * i] = static_cast<double>((*data_ptr)[i].real());
+        values[2 * i + 1] = static_cast<double>((*data_ptr)[i].imag());
+    }
+}
+
+/**
+ * @brief Copies the current sample to memory, as it is stored in the buffer.
+ *
+ * @param memory Room for GetSampleBytes() bytes
+ */
+template <typename T, size_t N>
+void Handler<std::array<std::complex<T>, N>>::CopySample(void* memory)
+{
+    *static_cast<std::array<std::complex<T>, N>*>(memory) = *data_ptr;
+}
+
+/**
+ * @brief Sets the signal from a sample stored as in the buffer, e.g. read
+ * from a binary LOG file.
+ *
+ * @param memory Sample of GetSampleBytes() bytes
+ */
+template <typename T, size_t N>
+void Handler<std::array<std::complex<T>, N>>::SetSample(const void* memory)
+{
+    *data_ptr = *static_cast<const std::array<std::complex<T>, N>*>(memory);
+}
+
+/**
+ * @brief Bits of each value in a waveform, 0 when the values are real numbers.
+ *
+ * @return size_t
+ */
+template <typename T, size_t N>
+size_t Handler<std::array<std::complex<T>, N>>::GetBitWidth()
+{
+    return WaveformValue<T>::WIDTH;
+}
+
+/**
+ * @brief Current value of the signal as waveform bits, see WaveformValue.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template <typename T, size_t N>
+void Handler<std::array<std::complex<T>, N>>::GetBits(uint64_t* values)
+{
+    for (size_t i { 0 }; i < N; ++i)
+    {
+        values[2 * i] = WaveformValue<T>::GetBits((*data_ptr)[i].real());
+        values[2 * i + 1] = WaveformValue<T>::GetBits((*data_ptr)[i].imag());
+    }
+}
+
+/**
+ * @brief Bytes of the value in binary, see GetValue and SetValue.
+ *
+ * @return size_t
+ */
+template <typename T, size_t N>
+size_t Handler<std::array<std::complex<T>, N>>::GetValueBytes()
+{
+    return sizeof(std::array<std::complex<T>, N>);
+}
+
+/**
+ * @brief Copies the value of the signal to memory, in its own type.
+ *
+ * @param memory Room for GetValueBytes() bytes
+ */
+template <typename T, size_t N>
+void Handler<std::array<std::complex<T>, N>>::GetValue(void* memory)
+{
+    *static_cast<std::array<std::complex<T>, N>*>(memory) = *data_ptr;
+}
+
+/**
+ * @brief Sets the signal from a value copied by GetValue.
+ *
+ * @param memory Value of GetValueBytes() bytes
+ */
+template <typename T, size_t N>
+void Handler<std::array<std::complex<T>, N>>::SetValue(const void* memory)
+{
+    *data_ptr = *static_cast<const std::array<std::complex<T>, N>*>(memory);
+}
+
 /**
  * @brief Deletes the buffer for std::array data.
  */
@@ -312,10 +464,10 @@ void Handler<std::array<std::complex<T>,N>>::SaveSample()
 /**
  * @brief Flushes the buffer to a binary file for std::array data.
  *
- * @param file Output file stream to write the binary data.
+ * @param file Output stream to write the binary data.
  */
 template <typename T, size_t N>
-void Handler<std::array<std::complex<T>,N>>::FlushToBinaryFile(std::ofstream& file)
+void Handler<std::array<std::complex<T>,N>>::FlushToBinaryFile(std::ostream& file)
 {
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
@@ -330,31 +482,29 @@ void Handler<std::array<std::complex<T>,N>>::FlushToBinaryFile(std::ofstream& fi
 /**
  * @brief Flushes the buffer to a text file for std::array data.
  *
- * @param file Output file stream to write the text data.
+ * @param file Output stream to write the text data.
  */
 template <typename T, size_t N>
-void Handler<std::array<std::complex<T>,N>>::FlushToTextFile(std::ofstream& file, char format)
+void Handler<std::array<std::complex<T>,N>>::FlushToTextFile(std::ostream& file, char format)
 {
-    /* Avoid "unused" warning */
-    (void) format;
-
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
 
-    std::stringstream ss;
-    ss.precision(std::numeric_limits<T>::digits10 + 1);
-    ss << std::showpos;
+    TextFormatter text(file, format);
 
     for (size_t i { 0 }; i < limit; i++)
     {
         for (size_t j { 0 }; j < N; j++)
         {
-            std::complex<T> data = buffer.get()[i][j];
-            ss << '(' << data.real() << data.imag() << "j)\t";            
+            if (j != 0)
+            {
+                text.Put(TextFormatter::ELEMENT_SEPARATOR);
+            }
+            text.Append(buffer.get()[i][j]);
         }
-        ss << '\n';
+        text.Put(TextFormatter::SAMPLE_SEPARATOR);
     }
-    file << ss.str();
+    text.Flush();
 }
 
 /**
@@ -90,16 +90,33 @@ public:
     std::string GetNBytesAsString() override;
     std::string GetSizeAsString() override;
 
+    /* Set and Get in binary */
+    size_t GetValueBytes() override;
+    void GetValue(void* memory) override;
+    void SetValue(const void* memory) override;
+
     /* Buffer commands */
     void CreateBuffer(size_t size) override;
     void DeleteBuffer() override;
+    void AttachBuffer(void* memory, size_t size) override;
     void SaveSample() override;
-    void FlushToBinaryFile(std::ofstream& file) override;
-    void FlushToTextFile(std::ofstream& file, char format) override;
+    void FlushToBinaryFile(std::ostream& file) override;
+    void FlushToTextFile(std::ostream& file, char format) override;
 
     /* Buffer information */
     bool BufferIsFull() override;
     bool IsBufferCreated() override;
+    size_t GetSampleBytes() override;
+
+    /* Sample values */
+    size_t GetValueCount() override;
+    void GetValues(double* values) override;
+    void CopySample(void* memory) override;
+    void SetSample(const void* memory) override;
+
+    /* Waveform values */
+    size_t GetBitWidth() override;
+    void GetBits(uint64_t* values) override;
 };
 
 /**
@@ -222,6 +239,135 @@ void Handler<std::complex<T>>::CreateBuffer(size_t size)
     }
 }
 
+/**
+ * @brief Uses memory owned by the caller as the buffer, e.g. a mapped file.
+ *
+ * @param memory Room for size samples.
+ * @param size Size of the buffer.
+ */
+template <typename T>
+void Handler<std::complex<T>>::AttachBuffer(void* memory, size_t size)
+{
+    buffer_size = size;
+    buffer_index = 0;
+    is_buffer_full = false;
+    buffer = std::shared_ptr<std::complex<T>>(static_cast<std::complex<T>*>(memory), [](std::complex<T>*) {});
+}
+
+/**
+ * @brief Bytes of a buffered sample, as written to binary files.
+ *
+ * @return size_t
+ */
+template <typename T>
+size_t Handler<std::complex<T>>::GetSampleBytes()
+{
+    return sizeof(std::complex<T>);
+}
+
+/**
+ * @brief Number of values of a sample, complex elements count twice.
+ *
+ * @return size_t
+ */
+template <typename T>
+size_t Handler<std::complex<T>>::GetValueCount()
+{
+    return 2;
+}
+
+/**
+ * @brief Current value of the signal as doubles, complex elements as real
+ * and imaginary parts.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template <typename T>
+void Handler<std::complex<T>>::GetValues(double* values)
+{
+    values[0] = static_cast<double>(data_ptr->real());
+    values[1] = static_cast<double>(data_ptr->imag());
+}
+
+/**
+ * @brief Copies the current sample to memory, as it is stored in the buffer.
+ *
+ * @param memory Room for GetSampleBytes() bytes
+ */
+template <typename T>
+void Handler<std::complex<T>>::CopySample(void* memory)
+{
+    *static_cast<std::complex<T>*>(memory) = *data_ptr;
+}
+
+/**
+ * @brief Sets the signal from a sample stored as in the buffer, e.g. read
+ * from a binary LOG file.
+ *
+ * @param memory Sample of GetSampleBytes() bytes
+ */
+template <typename T>
+void Handler<std::complex<T>>::SetSample(const void* memory)
+{
+    *data_ptr = *static_cast<const std::complex<T>*>(memory);
+}
+
+/**
+ * @brief Bits of each value in a waveform, 0 when the values are real numbers.
+ *
+ * @return size_t
+ */
+template <typename T>
+size_t Handler<std::complex<T>>::GetBitWidth()
+{
+    return WaveformValue<T>::WIDTH;
+}
+
+/**
+ * @brief Current value of the signal as waveform bits, see WaveformValue.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template <typename T>
+void Handler<std::complex<T>>::GetBits(uint64_t* values)
+{
+    values[0] = WaveformValue<T>::GetBits(data_ptr->real());
+    values[1] = WaveformValue<T>::GetBits(data_ptr->imag());
+}
+
+/**
+ * @brief Bytes of the value in binary, see GetValue and SetValue.
+ *
+ * @return size_t
+ */
+template <typename T>
+size_t Handler<std::complex<T>>::GetValueBytes()
+{
+    return sizeof(std::complex<T>);
+}
+
+/**
+ * @brief Copies the value of the signal to memory, in its own type.
+ *
+ * @param memory Room for GetValueBytes() bytes
+ */
+template <typename T>
+void Handler<std::complex<T>>::GetValue(void* memory)
+{
+    *static_cast<std::complex<T>*>(memory) = *data_ptr;
+}
+
+/**
+ * @brief Sets the signal from a value copied by GetValue.
+ *
+ * @param memory Value of GetValueBytes() bytes
+ */
+template <typename T>
+void Handler<std::complex<T>>::SetValue(const void* memory)
+{
+    *data_ptr = *static_cast<const std::complex<T>*>(memory);
+}
+
 /**
  * @brief Deletes the buffer for std::complex data.
  */
@@ -255,10 +401,10 @@ void Handler<std::complex<T>>::SaveSample()
 /**
  * @brief Flushes the buffer to a binary file for std::complex data.
  *
- * @param file Output file stream to write the binary data.
+ * @param file Output stream to write the binary data.
  */
 template <typename T>
-void Handler<std::complex<T>>::FlushToBinaryFile(std::ofstream& file)
+void Handler<std::complex<T>>::FlushToBinaryFile(std::ostream& file)
 {
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
@@ -268,28 +414,22 @@ void Handler<std::complex<T>>::FlushToBinaryFile(std::ofstream& file)
 /**
  * @brief Flushes the buffer to a text file for std::complex data.
  *
- * @param file Output file stream to write the text data.
+ * @param file Output stream to write the text data.
  */
 template <typename T>
-void Handler<std::complex<T>>::FlushToTextFile(std::ofstream& file, char format)
+void Handler<std::complex<T>>::FlushToTextFile(std::ostream& file, char format)
 {
-    /* Avoid "unused" warning */
-    (void) format;
-
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
 
-    std::stringstream ss;
-    ss.precision(std::numeric_limits<T>::digits10 + 1);
-    ss << std::showpos;
+    TextFormatter text(file, format);
 
-    for (size_t i = 0; i < limit; i++)
+    for (size_t i { 0 }; i < limit; i++)
     {
-        T real = buffer.get()[i].real();
-        T imag = buffer.get()[i].imag();
-        ss << '(' << real << imag << "j)\n";
+        text.Append(buffer.get()[i]);
+        text.Put(TextFormatter::SAMPLE_SEPARATOR);
     }
-    file << ss.str();
+    text.Flush();
 }
 
 /**
@@ -78,16 +78,33 @@ public:
     std::string GetNBytesAsString() override;
     std::string GetSizeAsString() override;
 
+    /* Set and Get in binary */
+    size_t GetValueBytes() override;
+    void GetValue(void* memory) override;
+    void SetValue(const void* memory) override;
+
     /* Buffer commands */
     void CreateBuffer(size_t size) override;
     void DeleteBuffer() override;
+    void AttachBuffer(void* memory, size_t size) override;
     void SaveSample() override;
-    void FlushToBinaryFile(std::ofstream& file) override;
-    void FlushToTextFile(std::ofstream& file, char format) override;
+    void FlushToBinaryFile(std::ostream& file) override;
+    void FlushToTextFile(std::ostream& file, char format) override;
 
     /* Buffer information */
     bool BufferIsFull() override;
     bool IsBufferCreated() override;
+    size_t GetSampleBytes() override;
+
+    /* Sample values */
+    size_t GetValueCount() override;
+    void GetValues(double* values) override;
+    void CopySample(void* memory) override;
+    void SetSample(const void* memory) override;
+
+    /* Waveform values */
+    size_t GetBitWidth() override;
+    void GetBits(uint64_t* values) override;
 };
 
 /**
@@ -205,6 +222,132 @@ void Handler<Port<T>>::CreateBuffer(size_t size)
     }
 }
 
+/**
+ * @brief Uses memory owned by the caller as the buffer, e.g. a mapped file.
+ *
+ * @param memory Room for size samples.
+ * @param size Size of the buffer.
+ */
+template<typename T>
+void Handler<Port<T>>::AttachBuffer(void* memory, size_t size)
+{
+    buffer_size = size;
+    buffer_index = 0;
+    is_buffer_full = false;
+    buffer = std::shared_ptr<T>(static_cast<T*>(memory), [](T*) {});
+}
+
+/**
+ * @brief Bytes of a buffered sample, as written to binary files.
+ *
+ * @return size_t
+ */
+template<typename T>
+size_t Handler<Port<T>>::GetSampleBytes()
+{
+    return sizeof(T);
+}
+
+/**
+ * @brief Number of values of a sample.
+ *
+ * @return size_t
+ */
+template<typename T>
+size_t Handler<Port<T>>::GetValueCount()
+{
+    return 1;
+}
+
+/**
+ * @brief Current value of the signal as doubles.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template<typename T>
+void Handler<Port<T>>::GetValues(double* values)
+{
+    values[0] = static_cast<double>(data_ptr->GetData());
+}
+
+/**
+ * @brief Copies the current sample to memory, as it is stored in the buffer.
+ *
+ * @param memory Room for GetSampleBytes() bytes
+ */
+template<typename T>
+void Handler<Port<T>>::CopySample(void* memory)
+{
+    *static_cast<T*>(memory) = data_ptr->GetData();
+}
+
+/**
+ * @brief Sets the signal from a sample stored as in the buffer, e.g. read
+ * from a binary LOG file.
+ *
+ * @param memory Sample of GetSampleBytes() bytes
+ */
+template<typename T>
+void Handler<Port<T>>::SetSample(const void* memory)
+{
+    data_ptr->SetData(*static_cast<const T*>(memory));
+}
+
+/**
+ * @brief Bits of each value in a waveform, 0 when the values are real numbers.
+ *
+ * @return size_t
+ */
+template<typename T>
+size_t Handler<Port<T>>::GetBitWidth()
+{
+    return WaveformValue<T>::WIDTH;
+}
+
+/**
+ * @brief Current value of the signal as waveform bits, see WaveformValue.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template<typename T>
+void Handler<Port<T>>::GetBits(uint64_t* values)
+{
+    values[0] = WaveformValue<T>::GetBits(data_ptr->GetData());
+}
+
+/**
+ * @brief Bytes of the value in binary, see GetValue and SetValue.
+ *
+ * @return size_t
+ */
+template<typename T>
+size_t Handler<Port<T>>::GetValueBytes()
+{
+    return sizeof(T);
+}
+
+/**
+ * @brief Copies the value of the signal to memory, in its own type.
+ *
+ * @param memory Room for GetValueBytes() bytes
+ */
+template<typename T>
+void Handler<Port<T>>::GetValue(void* memory)
+{
+    *static_cast<T*>(memory) = data_ptr->GetData();
+}
+
+/**
+ * @brief Sets the signal from a value copied by GetValue.
+ *
+ * @param memory Value of GetValueBytes() bytes
+ */
+template<typename T>
+void Handler<Port<T>>::SetValue(const void* memory)
+{
+    data_ptr->SetData(*static_cast<const T*>(memory));
+}
+
 /**
  * @brief Deletes the buffer for Port<T> data.
  */
@@ -241,7 +384,7 @@ void Handler<Port<T>>::SaveSample()
  * @param file Output file stream for writing the binary data.
  */
 template<typename T>
-void Handler<Port<T>>::FlushToBinaryFile(std::ofstream& file)
+void Handler<Port<T>>::FlushToBinaryFile(std::ostream& file)
 {
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
@@ -254,22 +397,19 @@ void Handler<Port<T>>::FlushToBinaryFile(std::ofstream& file)
  * @param file Output file stream for writing the text data.
  */
 template<typename T>
-void Handler<Port<T>>::FlushToTextFile(std::ofstream& file, char format)
+void Handler<Port<T>>::FlushToTextFile(std::ostream& file, char format)
 {
-    /* Avoid "unused" warning */
-    (void) format;
-    
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
 
-    std::stringstream ss;
-    ss.precision(std::numeric_limits<T>::digits10 + 1);
+    TextFormatter text(file, format);
 
     for (size_t i { 0 }; i < limit; i++)
     {
-        ss << buffer.get()[i] << '\n';
+        text.Append(buffer.get()[i]);
+        text.Put(TextFormatter::SAMPLE_SEPARATOR);
     }
-    file << ss.str();
+    text.Flush();
 }
 
 /**
@@ -78,16 +78,33 @@ public:
     std::string GetNBytesAsString() override;
     std::string GetSizeAsString() override;
 
+    /* Set and Get in binary */
+    size_t GetValueBytes() override;
+    void GetValue(void* memory) override;
+    void SetValue(const void* memory) override;
+
     /* Buffer commands */
     void CreateBuffer(size_t size) override;
     void DeleteBuffer() override;
+    void AttachBuffer(void* memory, size_t size) override;
     void SaveSample() override;
-    void FlushToBinaryFile(std::ofstream& file) override;
-    void FlushToTextFile(std::ofstream& file, char format) override;
+    void FlushToBinaryFile(std::ostream& file) override;
+    void FlushToTextFile(std::ostream& file, char format) override;
 
     /* Buffer information */
     bool BufferIsFull() override;
     bool IsBufferCreated() override;
+    size_t GetSampleBytes() override;
+
+    /* Sample values */
+    size_t GetValueCount() override;
+    void GetValues(double* values) override;
+    void CopySample(void* memory) override;
+    void SetSample(const void* memory) override;
+
+    /* Waveform values */
+    size_t GetBitWidth() override;
+    void GetBits(uint64_t* values) override;
 };
 
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
@@ -165,6 +182,133 @@ void Handler<Port<ac_fixed<W, I, S, Q, O>>>::CreateBuffer(size_t size)
     }
 }
 
+/**
+ * @brief Uses memory owned by the caller as the buffer, e.g. a mapped file.
+ *
+ * @param memory Room for size samples.
+ * @param size Size of the buffer.
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::AttachBuffer(void* memory, size_t size)
+{
+    buffer_size = size;
+    buffer_index = 0;
+    is_buffer_full = false;
+    buffer = std::shared_ptr<double>(static_cast<double*>(memory), [](double*) {});
+}
+
+/**
+ * @brief Bytes of a buffered sample, as written to binary files.
+ *
+ * @return size_t
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+size_t Handler<Port<ac_fixed<W, I, S, Q, O>>>::GetSampleBytes()
+{
+    return sizeof(double);
+}
+
+/**
+ * @brief Number of values of a sample.
+ *
+ * @return size_t
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+size_t Handler<Port<ac_fixed<W, I, S, Q, O>>>::GetValueCount()
+{
+    return 1;
+}
+
+/**
+ * @brief Current value of the signal as doubles.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::GetValues(double* values)
+{
+    values[0] = data_ptr->GetDataPointer()->to_double();
+}
+
+/**
+ * @brief Copies the current sample to memory, as it is stored in the buffer.
+ *
+ * @param memory Room for GetSampleBytes() bytes
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::CopySample(void* memory)
+{
+    *static_cast<double*>(memory) = data_ptr->GetDataPointer()->to_double();
+}
+
+/**
+ * @brief Sets the signal from a sample stored as in the buffer, e.g. read
+ * from a binary LOG file.
+ *
+ * @param memory Sample of GetSampleBytes() bytes
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::SetSample(const void* memory)
+{
+    ac_fixed<W, I, S, Q, O> data = *static_cast<const double*>(memory);
+    data_ptr->SetData(data);
+}
+
+/**
+ * @brief Bits of each value in a waveform, 0 when the values are real numbers.
+ *
+ * @return size_t
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+size_t Handler<Port<ac_fixed<W, I, S, Q, O>>>::GetBitWidth()
+{
+    return WaveformValue<ac_fixed<W, I, S, Q, O>>::WIDTH;
+}
+
+/**
+ * @brief Current value of the signal as waveform bits, see WaveformValue.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::GetBits(uint64_t* values)
+{
+    values[0] = WaveformValue<ac_fixed<W, I, S, Q, O>>::GetBits(*data_ptr->GetDataPointer());
+}
+
+/**
+ * @brief Bytes of the value in binary, see GetValue and SetValue.
+ *
+ * @return size_t
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+size_t Handler<Port<ac_fixed<W, I, S, Q, O>>>::GetValueBytes()
+{
+    return sizeof(ac_fixed<W, I, S, Q, O>);
+}
+
+/**
+ * @brief Copies the value of the signal to memory, in its own type.
+ *
+ * @param memory Room for GetValueBytes() bytes
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::GetValue(void* memory)
+{
+    *static_cast<ac_fixed<W, I, S, Q, O>*>(memory) = data_ptr->GetData();
+}
+
+/**
+ * @brief Sets the signal from a value copied by GetValue.
+ *
+ * @param memory Value of GetValueBytes() bytes
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::SetValue(const void* memory)
+{
+    data_ptr->SetData(*static_cast<const ac_fixed<W, I, S, Q, O>*>(memory));
+}
+
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
 void Handler<Port<ac_fixed<W, I, S, Q, O>>>::DeleteBuffer()
 {
@@ -190,7 +334,7 @@ void Handler<Port<ac_fixed<W, I, S, Q, O>>>::SaveSample()
 }
 
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
-void Handler<Port<ac_fixed<W, I, S, Q, O>>>::FlushToBinaryFile(std::ofstream& file)
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::FlushToBinaryFile(std::ostream& file)
 {
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
@@ -198,56 +342,21 @@ void Handler<Port<ac_fixed<W, I, S, Q, O>>>::FlushToBinaryFile(std::ofstream& fi
 }
 
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
-void Handler<Port<ac_fixed<W, I, S, Q, O>>>::FlushToTextFile(std::ofstream& file, char format)
+void Handler<Port<ac_fixed<W, I, S, Q, O>>>::FlushToTextFile(std::ostream& file, char format)
 {
-    /* Avoid "unused" warning */
-    (void) format;
-
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
 
-    std::stringstream ss;
+    TextFormatter text(file, format);
     ac_fixed<W, I, S, Q, O> aux;
 
-    switch (format)
+    for (size_t i { 0 }; i < limit; i++)
     {
-        /* HEX */
-        case 'h':
-
-            ss.precision(std::numeric_limits<unsigned int>::digits10 + 1);
-
-            for (size_t i { 0 }; i < limit; i++)
-            {
-                aux = buffer.get()[i];
-                ss << std::hex << aux.to_uint() << '\t';
-            }
-            break;
-
-        /* UINT */
-        case 'i':
-            
-            ss.precision(std::numeric_limits<unsigned int>::digits10 + 1);
-
-            for (size_t i { 0 }; i < limit; i++)
-            {
-                aux = buffer.get()[i];
-                ss << aux.to_uint() << '\t';
-            }
-            break;
-
-        /* DOUBLE */
-        default:
-
-            ss.precision(std::numeric_limits<double>::digits10 + 1);
-
-            for (size_t i { 0 }; i < limit; i++)
-            {
-                ss << buffer.get()[i] << '\n';
-            }
-            break;
+        aux = buffer.get()[i];
+        text.Append(aux);
+        text.Put(TextFormatter::SAMPLE_SEPARATOR);
     }
-
-    file << ss.str();
+    text.Flush();
 }
 
 template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
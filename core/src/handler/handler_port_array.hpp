@@ -89,16 +89,33 @@ public:
     std::string GetNBytesAsString() override;
     std::string GetSizeAsString() override;
 
+    /* Set and Get in binary */
+    size_t GetValueBytes() override;
+    void GetValue(void* memory) override;
+    void SetValue(const void* memory) override;
+
     /* Buffer commands */
     void CreateBuffer(size_t size) override;
     void DeleteBuffer() override;
+    void AttachBuffer(void* memory, size_t size) override;
     void SaveSample() override;
-    void FlushToBinaryFile(std::ofstream& file) override;
-    void FlushToTextFile(std::ofstream& file, char format) override;
+    void FlushToBinaryFile(std::ostream& file) override;
+    void FlushToTextFile(std::ostream& file, char format) override;
 
     /* Buffer information */
     bool BufferIsFull() override;
     bool IsBufferCreated() override;
+    size_t GetSampleBytes() override;
+
+    /* Sample values */
+    size_t GetValueCount() override;
+    void GetValues(double* values) override;
+    void CopySample(void* memory) override;
+    void SetSample(const void* memory) override;
+
+    /* Waveform values */
+    size_t GetBitWidth() override;
+    void GetBits(uint64_t* values) override;
 };
 
 /**
@@ -280,6 +297,142 @@ void Handler<Port<T, N>>::CreateBuffer(size_t size)
     }
 }
 
+/**
+ * @brief Uses memory owned by the caller as the buffer, e.g. a mapped file.
+ *
+ * @param memory Room for size samples.
+ * @param size Size of the buffer.
+ */
+template<class T, size_t N>
+void Handler<Port<T, N>>::AttachBuffer(void* memory, size_t size)
+{
+    buffer_size = size;
+    buffer_index = 0;
+    is_buffer_full = false;
+    buffer = std::shared_ptr<std::array<T, N>>(static_cast<std::array<T, N>*>(memory), [](std::array<T, N>*) {});
+}
+
+/**
+ * @brief Bytes of a buffered sample, as written to binary files.
+ *
+ * @return size_t
+ */
+template<class T, size_t N>
+size_t Handler<Port<T, N>>::GetSampleBytes()
+{
+    return sizeof(std::array<T, N>);
+}
+
+/**
+ * @brief Number of values of a sample.
+ *
+ * @return size_t
+ */
+template<class T, size_t N>
+size_t Handler<Port<T, N>>::GetValueCount()
+{
+    return N;
+}
+
+/**
+ * @brief Current value of the signal as doubles.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template<class T, size_t N>
+void Handler<Port<T, N>>::GetValues(double* values)
+{
+    std::array<T, N> data = data_ptr->GetData();
+    for (size_t i { 0 }; i < N; ++i)
+    {
+        values[i] = static_cast<double>(data[i]);
+    }
+}
+
+/**
+ * @brief Copies the current sample to memory, as it is stored in the buffer.
+ *
+ * @param memory Room for GetSampleBytes() bytes
+ */
+template<class T, size_t N>
+void Handler<Port<T, N>>::CopySample(void* memory)
+{
+    *static_cast<std::array<T, N>*>(memory) = data_ptr->GetData();
+}
+
+/**
+ * @brief Sets the signal from a sample stored as in the buffer, e.g. read
+ * from a binary LOG file.
+ *
+ * @param memory Sample of GetSampleBytes() bytes
+ */
+template<class T, size_t N>
+void Handler<Port<T, N>>::SetSample(const void* memory)
+{
+    std::array<T, N> data = *static_cast<const std::array<T, N>*>(memory);
+    data_ptr->SetData(data);
+}
+
+/**
+ * @brief Bits of each value in a waveform, 0 when the values are real numbers.
+ *
+ * @return size_t
+ */
+template<class T, size_t N>
+size_t Handler<Port<T, N>>::GetBitWidth()
+{
+    return WaveformValue<T>::WIDTH;
+}
+
+/**
+ * @brief Current value of the signal as waveform bits, see WaveformValue.
+ *
+ * @param values Output, GetValueCount() values
+ */
+template<class T, size_t N>
+void Handler<Port<T, N>>::GetBits(uint64_t* values)
+{
+    std::array<T, N> data = data_ptr->GetData();
+    for (size_t i { 0 }; i < N; ++i)
+    {
+        values[i] = WaveformValue<T>::GetBits(data[i]);
+    }
+}
+
+/**
+ * @brief Bytes of the value in binary, see GetValue and SetValue.
+ *
+ * @return size_t
+ */
+template<class T, size_t N>
+size_t Handler<Port<T, N>>::GetValueBytes()
+{
+    return sizeof(std::array<T, N>);
+}
+
+/**
+ * @brief Copies the value of the signal to memory, in its own type.
+ *
+ * @param memory Room for GetValueBytes() bytes
+ */
+template<class T, size_t N>
+void Handler<Port<T, N>>::GetValue(void* memory)
+{
+    *static_cast<std::array<T, N>*>(memory) = data_ptr->GetData();
+}
+
+/**
+ * @brief Sets the signal from a value copied by GetValue.
+ *
+ * @param memory Value of GetValueBytes() bytes
+ */
+template<class T, size_t N>
+void Handler<Port<T, N>>::SetValue(const void* memory)
+{
+    std::array<T, N> data = *static_cast<const std::array<T, N>*>(memory);
+    data_ptr->SetData(data);
+}
+
 /**
  * @brief Deletes the buffer for Port<T, N> data.
  */
@@ -316,7 +469,7 @@ void Handler<Port<T, N>>::SaveSample()
  * @param file Output file stream for writing the binary data.
  */
 template<class T, size_t N>
-void Handler<Port<T, N>>::FlushToBinaryFile(std::ofstream& file)
+void Handler<Port<T, N>>::FlushToBinaryFile(std::ostream& file)
 {
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
@@ -334,26 +487,26 @@ void Handler<Port<T, N>>::FlushToBinaryFile(std::ofstream& file)
  * @param file Output file stream for writing the text data.
  */
 template<class T, size_t N>
-void Handler<Port<T, N>>::FlushToTextFile(std::ofstream& file, char format)
+void Handler<Port<T, N>>::FlushToTextFile(std::ostream& file, char format)
 {
-    /* Avoid "unused" warning */
-    (void) format;
-
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
 
-    std::stringstream ss;
-    ss.precision(std::numeric_limits<T>::digits10 + 1);
+    TextFormatter text(file, format);
 
     for (size_t i { 0 }; i < limit; i++)
     {
         for (size_t j { 0 }; j < N; j++)
         {
-            ss << buffer.get()[i][j] << '\t';
+            if (j != 0)
+            {
+                text.Put(TextFormatter::ELEMENT_SEPARATOR);
+            }
+            text.Append(buffer.get()[i][j]);
         }
-        ss << '\n';
+        text.Put(TextFormatter::SAMPLE_SEPARATOR);
     }
-    file << ss.str();
+    text.Flush();
 }
 
 /**
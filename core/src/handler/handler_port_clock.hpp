@@ -79,16 +79,33 @@ public:
     std::string GetNBytesAsString() override;
     std::string GetSizeAsString() override;
 
+    /* Set and Get in binary */
+    size_t GetValueBytes() override;
+    void GetValue(void* memory) override;
+    void SetValue(const void* memory) override;
+
     /* Buffer commands */
     void CreateBuffer(size_t size) override;
     void DeleteBuffer() override;
+    void AttachBuffer(void* memory, size_t size) override;
     void SaveSample() override;
-    void FlushToBinaryFile(std::ofstream& file) override;
-    void FlushToTextFile(std::ofstream& file, char format) override;
+    void FlushToBinaryFile(std::ostream& file) override;
+    void FlushToTextFile(std::ostream& file, char format) override;
 
     /* Buffer information */
     bool BufferIsFull() override;
     bool IsBufferCreated() override;
+    size_t GetSampleBytes() override;
+
+    /* Sample values */
+    size_t GetValueCount() override;
+    void GetValues(double* values) override;
+    void CopySample(void* memory) override;
+    void SetSample(const void* memory) override;
+
+    /* Waveform values */
+    size_t GetBitWidth() override;
+    void GetBits(uint64_t* values) override;
 };
 
 inline Handler<Port<Clock>>::Handler(Port<Clock>& variable)
@@ -160,6 +177,133 @@ inline void Handler<Port<Clock>>::CreateBuffer(size_t size)
     }
 }
 
+/**
+ * @brief Uses memory owned by the caller as the buffer, e.g. a mapped file.
+ *
+ * @param memory Room for size samples.
+ * @param size Size of the buffer.
+ */
+inline void Handler<Port<Clock>>::AttachBuffer(void* memory, size_t size)
+{
+    buffer_size = size;
+    buffer_index = 0;
+    is_buffer_full = false;
+    buffer = std::shared_ptr<long double>(static_cast<long double*>(memory), [](long double*) {});
+}
+
+/**
+ * @brief Bytes of a buffered sample, as written to binary files.
+ *
+ * @return size_t
+ */
+inline size_t Handler<Port<Clock>>::GetSampleBytes()
+{
+    return sizeof(long double);
+}
+
+/**
+ * @brief Number of values of a sample.
+ *
+ * @return size_t
+ */
+inline size_t Handler<Port<Clock>>::GetValueCount()
+{
+    return 1;
+}
+
+/**
+ * @brief Current value of the signal as doubles.
+ *
+ * @param values Output, GetValueCount() values
+ */
+inline void Handler<Port<Clock>>::GetValues(double* values)
+{
+    values[0] = static_cast<double>(data_ptr->GetDataPointer()->GetLastEdgeTime());
+}
+
+/**
+ * @brief Copies the current sample to memory, as it is stored in the buffer.
+ *
+ * @param memory Room for GetSampleBytes() bytes
+ */
+inline void Handler<Port<Clock>>::CopySample(void* memory)
+{
+    *static_cast<long double*>(memory) = data_ptr->GetDataPointer()->GetLastEdgeTime();
+}
+
+/**
+ * @brief Sets the signal from a sample stored as in the buffer, e.g. read
+ * from a binary LOG file.
+ *
+ * @param memory Sample of GetSampleBytes() bytes
+ */
+inline void Handler<Port<Clock>>::SetSample(const void* memory)
+{
+    (void) memory;
+
+    std::string error_text = std::string(__FILE__) + ":"
+                           + std::to_string(__LINE__) + ": "
+                           + "ERROR [invalid set]: "
+                           + "Unable to assign values to clocks";
+    throw std::runtime_error(error_text);
+}
+
+/**
+ * @brief Bits of each value in a waveform, 0 when the values are real numbers.
+ *
+ * @return size_t
+ */
+inline size_t Handler<Port<Clock>>::GetBitWidth()
+{
+    return 0;
+}
+
+/**
+ * @brief Current value of the signal as waveform bits, see WaveformValue.
+ *
+ * @param values Output, GetValueCount() values
+ */
+inline void Handler<Port<Clock>>::GetBits(uint64_t* values)
+{
+    values[0] = WaveformValue<long double>::GetBits(data_ptr->GetDataPointer()->GetLastEdgeTime());
+}
+
+/**
+ * @brief Bytes of the value in binary, see GetValue and SetValue.
+ *
+ * @return size_t
+ */
+inline size_t Handler<Port<Clock>>::GetValueBytes()
+{
+    return sizeof(long double);
+}
+
+/**
+ * @brief Copies the value of the signal to memory, in its own type.
+ *
+ * @param memory Room for GetValueBytes() bytes
+ */
+inline void Handler<Port<Clock>>::GetValue(void* memory)
+{
+    *static_cast<long double*>(memory) = data_ptr->GetDataPointer()->GetLastEdgeTime();
+}
+
+/**
+ * @brief Sets the signal from a value copied by GetValue.
+ *
+ * @param memory Value of GetValueBytes() bytes
+ */
+inline void Handler<Port<Clock>>::SetValue(const void* memory)
+{
+    (void) memory;
+
+    std::string error_text = std::string(__FILE__) + ":"
+                           + std::to_string(__LINE__) + ": "
+                           + "ERROR [invalid set]: "
+                           + "Unable to assign values to clocks";
+    throw std::runtime_error(error_text);
+}
+
 inline void Handler<Port<Clock>>::DeleteBuffer()
 {
     buffer.reset();
@@ -184,30 +328,26 @@ inline void Handler<Port<Clock>>::SaveSample()
     }
 }
 
-inline void Handler<Port<Clock>>::FlushToBinaryFile(std::ofstream& file)
+inline void Handler<Port<Clock>>::FlushToBinaryFile(std::ostream& file)
 {
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
     file.write(reinterpret_cast<char*>(buffer.get()), limit * sizeof(long double));
 }
 
-inline void Handler<Port<Clock>>::FlushToTextFile(std::ofstream& file, char format)
+inline void Handler<Port<Clock>>::FlushToTextFile(std::ostream& file, char format)
 {
-    /* Avoid "unused" warning */
-    (void) format;
-
     size_t limit = is_buffer_full ? buffer_size : buffer_index;
     is_buffer_full = false;
 
-    std::stringstream ss;
-    ss.precision(std::numeric_limits<long double>::digits10 + 1);
+    TextFormatter text(file, format);
 
     for (size_t i { 0 }; i < limit; i++)
     {
-        ss << buffer.get()[i] << '\n';
+        text.Append(buffer.get()[i]);
+        text.Put(TextFormatter::SAMPLE_SEPARATOR);
     }
-
-    file << ss.str();
+    text.Flush();
 }
 
 inline bool Handler<Port<Clock>>::IsBufferCreated()
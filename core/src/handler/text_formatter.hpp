@@ -0,0 +1,370 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "ac_fixed.h"
+
+/*******************************************************************************
+* TEXT FORMATTER CLASS
+********************************************************************************/
+
+/**
+ * @brief Writes samples as text with std::to_chars into a per-thread buffer
+ * that is reused by every flush and handed to the stream in large blocks.
+ * 
+ * @details Formats:
+ * @details DEFAULT -> natural value, shortest round-trip for floating point
+ * @details DOUBLE  -> value converted to double, shortest round-trip
+ * @details INTEGER -> integer value, floating point is rounded to the nearest
+ *                     and fixed point keeps its integer part
+ * @details HEX     -> raw bits, zero padded to the width of the type. Long
+ *                     double has no integer of its size and is written as a
+ *                     hexadecimal float
+ * @details Layout: complex values are written as (real+imagj), or
+ *          (real,imag) in hex, array elements are separated by
+ *          ELEMENT_SEPARATOR and samples by SAMPLE_SEPARATOR.
+ */
+class TextFormatter
+{
+public:
+
+    enum Format {DEFAULT = '0', DOUBLE = 'd', INTEGER = 'i', HEX = 'h'};
+
+    static constexpr char ELEMENT_SEPARATOR { '\t' };
+    static constexpr char SAMPLE_SEPARATOR { '\n' };
+
+private:
+
+    /* Room for the longest value (a complex one) and size of the blocks given to the stream */
+    static constexpr size_t MAX_VALUE_CHARS { 128 };
+    static constexpr size_t BLOCK_CHARS { 1 << 20 };
+
+    std::ostream& file;
+    std::string& text;
+    size_t length { 0 };
+    char format;
+
+    static std::string& GetBuffer();
+    char* Reserve();
+    template<typename T> static char* WriteHex(char* first, T bits, size_t digits);
+    template<typename T> char* Write(char* first, T value) const;
+
+public:
+
+    TextFormatter(std::ostream& output, char text_format);
+
+    static bool IsValid(char text_format);
+
+    template<typename T> void Append(T value);
+    template<typename T> void Append(const std::complex<T>& value);
+    template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+    void Append(const ac_fixed<W, I, S, Q, O>& value);
+    void Put(char character);
+    void Flush();
+};
+
+/**
+ * @brief Construct a new text formatter
+ * 
+ * @param output Output stream
+ * @param text_format One of Format, unknown formats are written as DEFAULT
+ */
+inline TextFormatter::TextFormatter(std::ostream& output, char text_format)
+    : file(output), text(GetBuffer()), format(text_format)
+{
+}
+
+/**
+ * @brief Checks if the format is supported
+ * 
+ * @param text_format 
+ * @return true 
+ * @return false 
+ */
+inline bool TextFormatter::IsValid(char text_format)
+{
+    return text_format == Format::DEFAULT || text_format == Format::DOUBLE
+        || text_format == Format::INTEGER || text_format == Format::HEX;
+}
+
+/**
+ * @brief Buffer of the calling thread, the loggers of different domains
+ * format at the same time
+ * 
+ * @return std::string& 
+ */
+inline std::string& TextFormatter::GetBuffer()
+{
+    thread_local std::string buffer(BLOCK_CHARS + 2 * MAX_VALUE_CHARS, '\0');
+    return buffer;
+}
+
+/**
+ * @brief Makes room for one more value, handing a full block to the stream
+ * 
+ * @return char* Position of the next value
+ */
+inline char* TextFormatter::Reserve()
+{
+    if (length >= BLOCK_CHARS)
+    {
+        Flush();
+    }
+    return text.data() + length;
+}
+
+/**
+ * @brief Writes the pending text to the stream
+ * 
+ */
+inline void TextFormatter::Flush()
+{
+    file.write(text.data(), static_cast<std::streamsize>(length));
+    length = 0;
+}
+
+/**
+ * @brief Appends a separator
+ * 
+ * @param character 
+ */
+inline void TextFormatter::Put(char character)
+{
+    *Reserve() = character;
+    length++;
+}
+
+/**
+ * @brief Writes bits in hexadecimal, zero padded
+ * 
+ * @param first Output position
+ * @param bits Unsigned integer
+ * @param digits Minimum number of digits
+ * @return char* End of the text
+ */
+template<typename T>
+char* TextFormatter::WriteHex(char* first, T bits, size_t digits)
+{
+    char* last = std::to_chars(first, first + 2 * sizeof(T), bits, 16).ptr;
+    size_t written = static_cast<size_t>(last - first);
+
+    if (written < digits)
+    {
+        std::copy_backward(first, last, first + digits);
+        std::fill(first, first + digits - written, '0');
+        last = first + digits;
+    }
+    return last;
+}
+
+/**
+ * @brief Writes an arithmetic value
+ * 
+ * @param first Output position, with room for MAX_VALUE_CHARS / 2 characters
+ * @param value 
+ * @return char* End of the text
+ */
+template<typename T>
+char* TextFormatter::Write(char* first, T value) const
+{
+    static_assert(std::is_arithmetic_v<T>, "Only arithmetic values are written as text");
+
+    char* last = first + MAX_VALUE_CHARS / 2;
+
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        *first = value ? '1' : '0';
+        return first + 1;
+    }
+    else if (format == Format::HEX)
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            return WriteHex(first, static_cast<std::make_unsigned_t<T>>(value), 2 * sizeof(T));
+        }
+        else if constexpr (sizeof(T) == sizeof(uint32_t))
+        {
+            return WriteHex(first, std::bit_cast<uint32_t>(value), 2 * sizeof(T));
+        }
+        else if constexpr (sizeof(T) == sizeof(uint64_t))
+        {
+            return WriteHex(first, std::bit_cast<uint64_t>(value), 2 * sizeof(T));
+        }
+        else
+        {
+            return std::to_chars(first, last, value, std::chars_format::hex).ptr;
+        }
+    }
+    else if (format == Format::DOUBLE)
+    {
+        return std::to_chars(first, last, static_cast<double>(value)).ptr;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        /* Characters are numbers too */
+        return std::to_chars(first, last, +value).ptr;
+    }
+    else if (format == Format::INTEGER && std::isfinite(value))
+    {
+        return std::to_chars(first, last, std::llround(value)).ptr;
+    }
+    else
+    {
+        return std::to_chars(first, last, value).ptr;
+    }
+}
+
+/**
+ * @brief Appends an arithmetic value
+ * 
+ * @param value 
+ */
+template<typename T>
+void TextFormatter::Append(T value)
+{
+    char* first = Reserve();
+    length += static_cast<size_t>(Write(first, value) - first);
+}
+
+/**
+ * @brief Appends a complex value
+ * 
+ * @param value 
+ */
+template<typename T>
+void TextFormatter::Append(const std::complex<T>& value)
+{
+    char* first = Reserve();
+    char* last = first;
+
+    *last++ = '(';
+    last = Write(last, value.real());
+
+    if (format == Format::HEX)
+    {
+        *last++ = ',';
+        last = Write(last, value.imag());
+    }
+    else
+    {
+        /* Explicit sign of the imaginary part */
+        char* imag = last;
+        last = Write(imag, value.imag());
+
+        if (*imag != '-')
+        {
+            std::copy_backward(imag, last, last + 1);
+            *imag = '+';
+            last++;
+        }
+        *last++ = 'j';
+    }
+    *last++ = ')';
+
+    length += static_cast<size_t>(last - first);
+}
+
+/**
+ * @brief Appends a fixed point value
+ * 
+ * @param value 
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void TextFormatter::Append(const ac_fixed<W, I, S, Q, O>& value)
+{
+    switch (format)
+    {
+        case Format::HEX:
+
+            if constexpr (W <= 64)
+            {
+                char* first = Reserve();
+                uint64_t bits = ac_int<W, false>(value.template slc<W>(0)).to_uint64();
+                length += static_cast<size_t>(WriteHex(first, bits, (W + 3) / 4) - first);
+            }
+            else
+            {
+                /* Without the 0x prefix */
+                std::string bits = ac_int<W, false>(value.template slc<W>(0)).to_string(AC_HEX).substr(2);
+                bits.insert(0, std::max<size_t>((W + 3) / 4, bits.size()) - bits.size(), '0');
+
+                for (char digit : bits)
+                {
+                    Put(digit);
+                }
+            }
+            break;
+
+        case Format::INTEGER:
+
+            if constexpr (S)
+            {
+                Append(value.to_int64());
+            }
+            else
+            {
+                Append(value.to_uint64());
+            }
+            break;
+
+        default:
+
+            Append(value.to_double());
+            break;
+    }
+}
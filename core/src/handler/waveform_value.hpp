@@ -0,0 +1,119 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "ac_fixed.h"
+
+/*******************************************************************************
+* WAVEFORM VALUE CLASS
+********************************************************************************/
+
+/**
+ * @brief A value as it is shown in a waveform: bool, integers and fixed point
+ * are bit vectors of WIDTH bits, anything else is a real number (WIDTH 0)
+ * whose bits are the ones of a double.
+ * 
+ * @tparam T 
+ */
+template<typename T>
+class WaveformValue
+{
+public:
+
+    static constexpr size_t WIDTH { std::is_same_v<T, bool> ? 1 : std::is_integral_v<T> ? 8 * sizeof(T) : 0 };
+
+    static uint64_t GetBits(const T& value);
+};
+
+template<typename T>
+uint64_t WaveformValue<T>::GetBits(const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return value ? 1 : 0;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        return static_cast<std::make_unsigned_t<T>>(value);
+    }
+    else
+    {
+        return std::bit_cast<uint64_t>(static_cast<double>(value));
+    }
+}
+
+/**
+ * @brief Fixed point values are their raw bits, the ones wider than 64 bits
+ * are real numbers.
+ */
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+class WaveformValue<ac_fixed<W, I, S, Q, O>>
+{
+public:
+
+    static constexpr size_t WIDTH { (W <= 64) ? W : 0 };
+
+    static uint64_t GetBits(const ac_fixed<W, I, S, Q, O>& value);
+};
+
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+uint64_t WaveformValue<ac_fixed<W, I, S, Q, O>>::GetBits(const ac_fixed<W, I, S, Q, O>& value)
+{
+    if constexpr (W <= 64)
+    {
+        return ac_int<W, false>(value.template slc<W>(0)).to_uint64();
+    }
+    else
+    {
+        return std::bit_cast<uint64_t>(value.to_double());
+    }
+}
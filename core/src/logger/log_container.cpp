@@ -0,0 +1,170 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstring>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "log_container.hpp"
+
+/*******************************************************************************
+* LOG CONTAINER CLASS
+********************************************************************************/
+
+template <typename T>
+static void Append(std::string& data, T value)
+{
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    data.append(bytes, sizeof(T));
+}
+
+static void Append(std::string& data, const std::string& text)
+{
+    Append(data, static_cast<uint32_t>(text.size()));
+    data.append(text);
+}
+
+/**
+ * @brief Add a signal to the catalogue, before Open().
+ * 
+ * @param signal 
+ * @return size_t Signal number in the catalogue
+ */
+size_t LogContainer::AddSignal(const Signal& signal)
+{
+    signals.push_back(signal);
+    return signals.size() - 1;
+}
+
+bool LogContainer::IsEmpty() const
+{
+    return signals.empty();
+}
+
+/**
+ * @brief Create the file and queue its header with the signal catalogue.
+ * 
+ * @param writer 
+ * @param file_name 
+ */
+void LogContainer::Open(LogWriter& writer, const std::string& file_name)
+{
+    sink = writer.Open(file_name, true, false, signals.size());
+
+    std::string header;
+    header.append(MAGIC, sizeof(MAGIC));
+    Append(header, VERSION);
+    Append(header, static_cast<uint32_t>(signals.size()));
+
+    for (const Signal& signal : signals)
+    {
+        Append(header, signal.name);
+        Append(header, signal.clock);
+        Append(header, signal.type);
+        Append(header, signal.bytes);
+        Append(header, signal.size);
+        Append(header, static_cast<uint8_t>(signal.edge));
+        Append(header, signal.begin);
+        Append(header, signal.step);
+        Append(header, signal.end);
+    }
+
+    offset = header.size();
+    writer.Write(*sink, std::move(header));
+}
+
+LogWriter::SinkPtr LogContainer::GetSink() const
+{
+    return sink;
+}
+
+/**
+ * @brief Queue a chunk of samples of a signal and index it. Logs of several
+ * clock domains can write concurrently.
+ * 
+ * @param writer 
+ * @param signal 
+ * @param chunk 
+ */
+void LogContainer::Write(LogWriter& writer, size_t signal, std::string&& chunk)
+{
+    if (chunk.empty())
+    {
+        return;
+    }
+
+    uint64_t sample_bytes = uint64_t {signals[signal].bytes} * signals[signal].size;
+
+    /* Chunks are queued in index order */
+    std::lock_guard<std::mutex> lock(mutex);
+    index.push_back({static_cast<uint32_t>(signal), 0, offset, chunk.size() / sample_bytes});
+    offset += chunk.size();
+    writer.Write(*sink, std::move(chunk));
+}
+
+/**
+ * @brief Queue the index and the trailer, then close the file.
+ * 
+ * @param writer 
+ */
+void LogContainer::Close(LogWriter& writer)
+{
+    std::string footer;
+
+    for (const IndexEntry& entry : index)
+    {
+        Append(footer, entry.signal);
+        Append(footer, entry.reserved);
+        Append(footer, entry.offset);
+        Append(footer, entry.n_samples);
+    }
+
+    Append(footer, offset);
+    Append(footer, static_cast<uint64_t>(index.size()));
+    footer.append(MAGIC, sizeof(MAGIC));
+
+    writer.Write(*sink, std::move(footer));
+    writer.Close(*sink);
+}
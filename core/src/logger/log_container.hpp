@@ -0,0 +1,119 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "log_writer.hpp"
+
+/*******************************************************************************
+* LOG CONTAINER CLASS
+********************************************************************************/
+
+/**
+ * @brief Single file holding the samples of several logs, column by column.
+ * 
+ * @details Layout, in host byte order:
+ * @details header  -> "HALCONLC", version (u32), number of signals (u32)
+ * @details signal  -> name, clock and type (u32 length + chars), bytes per
+ *                     element (u32), elements per sample (u32), edge (u8),
+ *                     begin, step and end (u64), for each signal
+ * @details chunks  -> raw samples of one signal, as in a .bin log file
+ * @details index   -> signal (u32), reserved (u32), offset and samples (u64),
+ *                     for each chunk in file order
+ * @details trailer -> index offset (u64), number of chunks (u64), "HALCONLC"
+ */
+class LogContainer
+{
+public:
+
+    /* Signal catalogue entry */
+    struct Signal
+    {
+        std::string name;
+        std::string clock;
+        std::string type;
+        uint32_t bytes;
+        uint32_t size;
+        char edge;
+        uint64_t begin;
+        uint64_t step;
+        uint64_t end;
+    };
+
+    static constexpr char MAGIC[8] {'H', 'A', 'L', 'C', 'O', 'N', 'L', 'C'};
+    static constexpr uint32_t VERSION { 1 };
+
+private:
+
+    struct IndexEntry
+    {
+        uint32_t signal;
+        uint32_t reserved;
+        uint64_t offset;
+        uint64_t n_samples;
+    };
+
+    std::vector<Signal> signals;
+    std::vector<IndexEntry> index;
+    LogWriter::SinkPtr sink;
+    uint64_t offset { 0 };
+    std::mutex mutex;
+
+public:
+
+    size_t AddSignal(const Signal& signal);
+    bool IsEmpty() const;
+    void Open(LogWriter& writer, const std::string& file_name);
+    LogWriter::SinkPtr GetSink() const;
+    void Write(LogWriter& writer, size_t signal, std::string&& chunk);
+    void Close(LogWriter& writer);
+};
@@ -0,0 +1,260 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "log_writer.hpp"
+
+/*******************************************************************************
+* CHUNK BUFFER CLASS
+********************************************************************************/
+
+ChunkBuffer::ChunkBuffer(std::string& chunk) : data(chunk)
+{
+}
+
+ChunkBuffer::int_type ChunkBuffer::overflow(int_type ch)
+{
+    if (!traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        data.push_back(traits_type::to_char_type(ch));
+    }
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize ChunkBuffer::xsputn(const char* s, std::streamsize n)
+{
+    data.append(s, static_cast<size_t>(n));
+    return n;
+}
+
+/*******************************************************************************
+* LOG WRITER CLASS
+********************************************************************************/
+
+LogWriter::~LogWriter()
+{
+    Terminate();
+}
+
+/**
+ * @brief Start the writer thread.
+ * 
+ */
+void LogWriter::Init()
+{
+    if (!worker.joinable())
+    {
+        stop = false;
+        worker = std::thread(&LogWriter::Worker, this);
+    }
+}
+
+/**
+ * @brief Create the sink of a log file. The writer opens it, truncating the
+ * file unless is_append is set.
+ * 
+ * @param file_name 
+ * @param is_binary 
+ * @param is_append 
+ * @param n_logs Logs sharing the sink
+ * @return LogWriter::SinkPtr 
+ */
+LogWriter::SinkPtr LogWriter::Open(std::string file_name, bool is_binary, bool is_append, size_t n_logs)
+{
+    SinkPtr sink = std::make_shared<Sink>();
+    sink->file_name = std::move(file_name);
+    sink->max_pending = MAX_PENDING * n_logs;
+    sink->mode = std::ofstream::out
+               | (is_binary ? std::ofstream::binary : std::ios::openmode {})
+               | (is_append ? std::ofstream::app : std::ofstream::trunc);
+
+    Push(*sink, OPEN, {});
+
+    std::lock_guard<std::mutex> lock(mutex);
+    sinks.push_back(sink);
+    return sink;
+}
+
+/**
+ * @brief Empty chunk for the next flush of the sink. Blocks while the sink
+ * has MAX_PENDING chunks per log waiting to be written.
+ * 
+ * @param sink 
+ * @return std::string 
+ */
+std::string LogWriter::Acquire(Sink& sink)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    space_ready.wait(lock, [&]() { return sink.pending < sink.max_pending; });
+
+    if (free_chunks.empty())
+    {
+        return {};
+    }
+
+    std::string chunk = std::move(free_chunks.back());
+    free_chunks.pop_back();
+    return chunk;
+}
+
+/**
+ * @brief Queue a chunk to be appended to the sink file.
+ * 
+ * @param sink 
+ * @param chunk 
+ */
+void LogWriter::Write(Sink& sink, std::string&& chunk)
+{
+    Push(sink, WRITE, std::move(chunk));
+}
+
+/**
+ * @brief Queue the closing of the sink file, after its pending chunks.
+ * 
+ * @param sink 
+ */
+void LogWriter::Close(Sink& sink)
+{
+    Push(sink, CLOSE, {});
+}
+
+/**
+ * @brief Write every queued chunk, stop the writer thread and close the
+ * files.
+ * 
+ */
+void LogWriter::Terminate()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    work_ready.notify_one();
+
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+
+    /* Files still open */
+    for (SinkPtr& sink : sinks)
+    {
+        sink->file.close();
+    }
+    sinks.clear();
+}
+
+void LogWriter::Push(Sink& sink, Operation operation, std::string&& data)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (operation == WRITE)
+        {
+            sink.pending++;
+        }
+        tasks.push_back({&sink, operation, std::move(data)});
+    }
+    work_ready.notify_one();
+}
+
+void LogWriter::Worker()
+{
+    std::deque<Task> batch;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            work_ready.wait(lock, [&]() { return stop || !tasks.empty(); });
+
+            if (tasks.empty())
+            {
+                return;
+            }
+            std::swap(batch, tasks);
+        }
+
+        for (Task& task : batch)
+        {
+            Sink& sink = *task.sink;
+
+            switch (task.operation)
+            {
+                case OPEN:
+                    sink.file.open(sink.file_name, sink.mode);
+                    break;
+
+                case WRITE:
+                    /* Closed at the end of its window, but still logging */
+                    if (!sink.file.is_open())
+                    {
+                        sink.file.open(sink.file_name, (sink.mode & ~std::ofstream::trunc) | std::ofstream::app);
+                    }
+
+                    if (sink.file.is_open())
+                    {
+                        sink.file.write(task.data.data(), static_cast<std::streamsize>(task.data.size()));
+                    }
+                    break;
+
+                case CLOSE:
+                    sink.file.close();
+                    break;
+            }
+        }
+
+        /* Recycle the chunks and release the sinks */
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (Task& task : batch)
+            {
+                if (task.operation == WRITE)
+                {
+                    task.sink->pending--;
+                    task.data.clear();
+                    free_chunks.push_back(std::move(task.data));
+                }
+            }
+        }
+        space_ready.notify_all();
+        batch.clear();
+    }
+}
@@ -0,0 +1,144 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*******************************************************************************
+* CHUNK BUFFER CLASS
+********************************************************************************/
+
+/**
+ * @brief Stream buffer that appends to a string, so a handler can flush its
+ * samples into a chunk for the writer thread.
+ */
+class ChunkBuffer : public std::streambuf
+{
+private:
+
+    std::string& data;
+
+protected:
+
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+public:
+
+    explicit ChunkBuffer(std::string& chunk);
+};
+
+/*******************************************************************************
+* LOG WRITER CLASS
+********************************************************************************/
+
+/**
+ * @brief Background thread writing the log files. Each log command keeps one
+ * sink, a file opened once and written in order. The simulation hands over
+ * filled chunks and only waits when a sink already has MAX_PENDING chunks
+ * queued per log writing to it, so the writer can fall behind by a bounded
+ * amount.
+ */
+class LogWriter
+{
+public:
+
+    /* Output file of a log command, only touched by the writer thread */
+    struct Sink
+    {
+        std::string file_name;
+        std::ios::openmode mode;
+        std::ofstream file;
+        size_t pending { 0 };
+        size_t max_pending { 0 };
+    };
+
+    using SinkPtr = std::shared_ptr<Sink>;
+
+private:
+
+    enum Operation {OPEN, WRITE, CLOSE};
+
+    struct Task
+    {
+        Sink* sink;
+        Operation operation;
+        std::string data;
+    };
+
+    /* Chunks queued per sink, besides the one being filled */
+    static constexpr size_t MAX_PENDING { 2 };
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable work_ready;
+    std::condition_variable space_ready;
+    std::deque<Task> tasks;
+    std::vector<std::string> free_chunks;
+    std::vector<SinkPtr> sinks;
+    bool stop { false };
+
+    void Worker();
+    void Push(Sink& sink, Operation operation, std::string&& data);
+
+public:
+
+    LogWriter() = default;
+    ~LogWriter();
+
+    void Init();
+    SinkPtr Open(std::string file_name, bool is_binary, bool is_append, size_t n_logs = 1);
+    std::string Acquire(Sink& sink);
+    void Write(Sink& sink, std::string&& chunk);
+    void Close(Sink& sink);
+    void Terminate();
+};
@@ -43,8 +43,9 @@
  * 
  * @param output_path The path to the folder where the files are stored.
  * @param max_buffer_size The maximum size of the buffer. The optimal value depends on the host machine.
+ * @param log_list Log commands, the ones of file type container share one file.
  */
-void Logger::Init(std::string out_path, size_t max_size)
+void Logger::Init(std::string out_path, size_t max_size, std::vector<LogCommand>& log_list)
 {
     /* Buffer size must be begger than one */
     if (max_size < 1)
@@ -65,6 +66,33 @@ void Logger::Init(std::string out_path, size_t max_size)
     {
         std::filesystem::create_directory(output_path);
     }
+
+    /* Log files are written in the background */
+    writer.Init();
+
+    /* Container and waveform file of the run */
+    for (LogCommand& log : log_list)
+    {
+        if (log.file_type == LogCommand::FileType::CONTAINER)
+        {
+            log.Attach(container);
+        }
+
+        if (log.file_type == LogCommand::FileType::WAVEFORM)
+        {
+            log.Attach(waveform);
+        }
+    }
+
+    if (!container.IsEmpty())
+    {
+        container.Open(writer, output_path + "logs.hlc");
+    }
+
+    if (!waveform.IsEmpty())
+    {
+        waveform.Open(writer, output_path + "logs.vcd");
+    }
 }
 
 /**
@@ -72,11 +100,51 @@ void Logger::Init(std::string out_path, size_t max_size)
  * 
  * @param log_list 
  */
-void Logger::Run(std::vector<LogCommand*> log_list)
+void Logger::Run(const std::vector<LogCommand*>& log_list)
 {
     for (auto &&log : log_list)
     {
-        log->Run(output_path, max_buffer_size);
+        log->Run(writer, output_path, max_buffer_size);
+    }
+}
+
+/**
+ * @brief Process each stat command in stat_list.
+ * 
+ * @param stat_list 
+ */
+void Logger::Run(const std::vector<StatCommand*>& stat_list)
+{
+    for (auto &&stat : stat_list)
+    {
+        stat->Run(output_path);
+    }
+}
+
+/**
+ * @brief Process each capture command in capture_list.
+ * 
+ * @param capture_list 
+ * @param tick Reference clock tick of the samples
+ */
+void Logger::Run(const std::vector<CaptureCommand*>& capture_list, unsigned long long tick)
+{
+    for (auto &&capture : capture_list)
+    {
+        capture->Run(output_path, tick);
+    }
+}
+
+/**
+ * @brief Called once every log has run up to the same time and none is
+ * running, so the waveform changes can be written in time order.
+ * 
+ */
+void Logger::Sync()
+{
+    if (!waveform.IsEmpty())
+    {
+        waveform.Sync(writer);
     }
 }
 
@@ -84,18 +152,49 @@ void Logger::Run(std::vector<LogCommand*> log_list)
  * @brief Ensures that logger finishes correctly, saving buffers in files and freeing memory
  * 
  * @param log_list 
+ * @param flog_list 
+ * @param stat_list 
+ * @param capture_list 
  */
-void Logger::Terminate(std::vector<LogCommand*> log_list, std::vector<FinalLogCommand*> flog_list)
+void Logger::Terminate(const std::vector<LogCommand*>& log_list, const std::vector<FinalLogCommand*>& flog_list,
+                       const std::vector<StatCommand*>& stat_list, const std::vector<CaptureCommand*>& capture_list)
 {
     /* Flush incomplete buffer */
     for (auto &&log : log_list)
     {
-        log->Terminate(output_path);
+        log->Terminate(writer, output_path);
+    }
+
+    /* Container index */
+    if (!container.IsEmpty())
+    {
+        container.Close(writer);
+    }
+
+    /* Last waveform changes */
+    if (!waveform.IsEmpty())
+    {
+        waveform.Close(writer);
     }
 
+    /* Wait for the log files */
+    writer.Terminate();
+
     /* Final Log */
     for (auto &&flog : flog_list)
     {
         flog->Run(output_path);
     }
+
+    /* Statistics of the run */
+    for (auto &&stat : stat_list)
+    {
+        stat->Terminate(output_path);
+    }
+
+    /* Windows cut by the end of the run */
+    for (auto &&capture : capture_list)
+    {
+        capture->Terminate(output_path);
+    }
 }
\ No newline at end of file
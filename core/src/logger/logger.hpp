@@ -45,7 +45,12 @@
 #include <vector>
 
 #include "log_command.hpp"
+#include "log_container.hpp"
+#include "log_writer.hpp"
+#include "waveform_file.hpp"
 #include "final_log_command.hpp"
+#include "stat_command.hpp"
+#include "capture_command.hpp"
 
 /**
  * @brief Logger class: Handles logger commands to store the data in files.
@@ -57,10 +62,17 @@ private:
 
     std::string output_path {"./out/"};
     size_t max_buffer_size { 5 };
+    LogWriter writer;
+    LogContainer container;
+    WaveformFile waveform;
 
 public:
    
-    void Init(std::string output_path, size_t buffer_size);
-    void Run(std::vector<LogCommand*> log_list);
-    void Terminate(std::vector<LogCommand*> log_list, std::vector<FinalLogCommand*> flog_list);
+    void Init(std::string output_path, size_t buffer_size, std::vector<LogCommand>& log_list);
+    void Run(const std::vector<LogCommand*>& log_list);
+    void Run(const std::vector<StatCommand*>& stat_list);
+    void Run(const std::vector<CaptureCommand*>& capture_list, unsigned long long tick);
+    void Sync();
+    void Terminate(const std::vector<LogCommand*>& log_list, const std::vector<FinalLogCommand*>& flog_list,
+                   const std::vector<StatCommand*>& stat_list, const std::vector<CaptureCommand*>& capture_list);
 };
\ No newline at end of file
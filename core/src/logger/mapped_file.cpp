@@ -0,0 +1,194 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "mapped_file.hpp"
+
+/*******************************************************************************
+* MAPPED FILE CLASS
+********************************************************************************/
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+
+    if (file_descriptor >= 0)
+    {
+        close(file_descriptor);
+    }
+}
+
+/**
+ * @brief Create (or clear) the file and map its first window. The window
+ * holds n_samples, up to MAX_WINDOW_BYTES, rounded up to whole pages.
+ * 
+ * @param name 
+ * @param bytes_per_sample 
+ * @param n_samples Expected number of samples, more can be written. Zero
+ * if unknown, then windows of STREAM_WINDOW_BYTES are used.
+ */
+void MappedFile::Open(const std::string& name, size_t bytes_per_sample, size_t n_samples)
+{
+    file_name = name;
+    sample_bytes = bytes_per_sample;
+    window_index = 0;
+
+    /* Window offsets must be page aligned, so windows hold whole pages of samples */
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t max_samples = std::max(MAX_WINDOW_BYTES / sample_bytes, size_t {1});
+    size_t stream_samples = std::max(STREAM_WINDOW_BYTES / sample_bytes, size_t {1});
+    window_samples = std::min((n_samples == 0) ? stream_samples : n_samples, max_samples);
+    window_samples = (window_samples + page_size - 1) / page_size * page_size;
+    window_bytes = window_samples * sample_bytes;
+
+    file_descriptor = open(file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file_descriptor < 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + file_name + ": " + std::strerror(errno);
+        throw std::runtime_error(error_text);
+    }
+
+    Map();
+}
+
+/**
+ * @brief Map the window that follows the current one, growing the file.
+ * 
+ * @return void* 
+ */
+void* MappedFile::Next()
+{
+    Unmap();
+    window_index++;
+    Map();
+    return window;
+}
+
+/**
+ * @brief Unmap the last window and trim the file after the samples written.
+ * 
+ * @param n_last_samples Samples written in the current window
+ */
+void MappedFile::Close(size_t n_last_samples)
+{
+    if (file_descriptor < 0)
+    {
+        return;
+    }
+
+    Unmap();
+
+    off_t size = static_cast<off_t>(window_index * window_bytes + n_last_samples * sample_bytes);
+    if (ftruncate(file_descriptor, size) != 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be resized]: "
+                               + file_name + ": " + std::strerror(errno);
+        throw std::runtime_error(error_text);
+    }
+
+    close(file_descriptor);
+    file_descriptor = -1;
+}
+
+void* MappedFile::GetWindow() const
+{
+    return window;
+}
+
+size_t MappedFile::GetWindowSamples() const
+{
+    return window_samples;
+}
+
+void MappedFile::Map()
+{
+    off_t offset = static_cast<off_t>(window_index * window_bytes);
+
+    if (ftruncate(file_descriptor, offset + static_cast<off_t>(window_bytes)) != 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be resized]: "
+                               + file_name + ": " + std::strerror(errno);
+        throw std::runtime_error(error_text);
+    }
+
+    window = mmap(nullptr, window_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, offset);
+    if (window == MAP_FAILED)
+    {
+        window = nullptr;
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be mapped]: "
+                               + file_name + ": " + std::strerror(errno);
+        throw std::runtime_error(error_text);
+    }
+
+    /* The window is only written, reading ahead the file just adds page faults */
+    madvise(window, window_bytes, MADV_RANDOM);
+}
+
+void MappedFile::Unmap()
+{
+    if (window != nullptr)
+    {
+        munmap(window, window_bytes);
+        window = nullptr;
+    }
+}
@@ -0,0 +1,325 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <numeric>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "waveform_file.hpp"
+
+/*******************************************************************************
+* WAVEFORM FILE CLASS
+********************************************************************************/
+
+/**
+ * @brief Add a signal, before Open(). A signal added twice, e.g. sampled with
+ * two clocks, gets a numbered name.
+ * 
+ * @param name Full name of the signal
+ * @param width Bits of each value, 0 for reals
+ * @param n_values Values of a sample
+ * @param size Elements of a sample, half the values for complex signals
+ * @return size_t Signal number
+ */
+size_t WaveformFile::AddSignal(const std::string& name, size_t width, size_t n_values, size_t size)
+{
+    std::string unique_name = name;
+
+    for (size_t copy = 2; std::any_of(signals.begin(), signals.end(),
+                                      [&](const Signal& signal) { return signal.name == unique_name; }); copy++)
+    {
+        unique_name = name + "_" + std::to_string(copy);
+    }
+
+    Signal signal;
+    signal.name = unique_name;
+    signal.width = width;
+    signal.n_values = n_values;
+    signal.size = size;
+    signal.first_variable = widths.size();
+    signal.values.resize(n_values);
+    signal.sample.resize(n_values);
+    signal.has_values = false;
+
+    for (size_t i = 0; i < n_values; i++)
+    {
+        widths.push_back(width);
+        identifiers.push_back(GetIdentifier(widths.size() - 1));
+    }
+
+    signals.push_back(std::move(signal));
+    return signals.size() - 1;
+}
+
+bool WaveformFile::IsEmpty() const
+{
+    return signals.empty();
+}
+
+/**
+ * @brief Short VCD identifier, in base 94 over the printable characters
+ * 
+ * @param variable 
+ * @return std::string 
+ */
+std::string WaveformFile::GetIdentifier(size_t variable)
+{
+    std::string identifier;
+
+    do
+    {
+        identifier += static_cast<char>('!' + variable % 94);
+        variable /= 94;
+    } while (variable != 0);
+
+    return identifier;
+}
+
+/**
+ * @brief Create the file and queue its header, with the scopes of the signals
+ * 
+ * @param writer 
+ * @param file_name 
+ */
+void WaveformFile::Open(LogWriter& writer, const std::string& file_name)
+{
+    sink = writer.Open(file_name, false, false);
+
+    std::string header = "$version HALCON $end\n"
+                         "$timescale 1 fs $end\n";
+
+    /* Signals in name order, so each scope is opened once */
+    std::vector<size_t> order(signals.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](size_t a, size_t b) { return signals[a].name < signals[b].name; });
+
+    std::vector<std::string> scopes;
+
+    for (size_t index : order)
+    {
+        const Signal& signal = signals[index];
+
+        std::vector<std::string> path;
+        size_t first = 0;
+        for (size_t dot = signal.name.find('.'); dot != std::string::npos; dot = signal.name.find('.', first))
+        {
+            path.push_back(signal.name.substr(first, dot - first));
+            first = dot + 1;
+        }
+        std::string leaf = signal.name.substr(first);
+
+        /* Close the scopes that differ and open the new ones */
+        size_t common = 0;
+        while (common < scopes.size() && common < path.size() && scopes[common] == path[common])
+        {
+            common++;
+        }
+
+        for (size_t i = scopes.size(); i > common; i--)
+        {
+            header += "$upscope $end\n";
+        }
+
+        for (size_t i = common; i < path.size(); i++)
+        {
+            header += "$scope module " + path[i] + " $end\n";
+        }
+
+        scopes = std::move(path);
+
+        /* One variable per value: name, name_<element>, name_re or name_<element>_re */
+        bool is_complex = (signal.n_values == 2 * signal.size);
+
+        for (size_t i = 0; i < signal.n_values; i++)
+        {
+            size_t element = is_complex ? i / 2 : i;
+            std::string name = leaf;
+
+            if (signal.size > 1)
+            {
+                name.push_back('_');
+                name.append(std::to_string(element));
+            }
+
+            if (is_complex)
+            {
+                name.append((i % 2 == 0) ? "_re" : "_im");
+            }
+
+            std::string type = (signal.width == 0) ? "real 64" : "wire " + std::to_string(signal.width);
+            header += "$var " + type + " " + identifiers[signal.first_variable + i] + " " + name + " $end\n";
+        }
+    }
+
+    for (size_t i = 0; i < scopes.size(); i++)
+    {
+        header += "$upscope $end\n";
+    }
+
+    header += "$enddefinitions $end\n";
+    writer.Write(*sink, std::move(header));
+}
+
+/**
+ * @brief Sample a signal, keeping the values that changed. Each signal is
+ * sampled by one log, so logs of different domains don't share data.
+ * 
+ * @param signal Signal number
+ * @param time Time of the clock edge
+ * @param handler Handler of the signal
+ */
+void WaveformFile::Sample(size_t signal, Ticks time, AbstractHandler& handler)
+{
+    Signal& entry = signals[signal];
+    handler.GetBits(entry.sample.data());
+
+    uint64_t time_fs = static_cast<uint64_t>(time / TICKS_PER_FEMTOSECOND);
+
+    for (size_t i = 0; i < entry.n_values; i++)
+    {
+        if (!entry.has_values || entry.sample[i] != entry.values[i])
+        {
+            entry.values[i] = entry.sample[i];
+            entry.changes.push_back({time_fs, entry.sample[i], entry.first_variable + i});
+        }
+    }
+
+    entry.has_values = true;
+}
+
+/**
+ * @brief Called when every log has sampled up to the same time, with no log
+ * running. Writes the changes every SYNC_PERIOD calls.
+ * 
+ * @param writer 
+ */
+void WaveformFile::Sync(LogWriter& writer)
+{
+    if (++n_syncs < SYNC_PERIOD)
+    {
+        return;
+    }
+
+    n_syncs = 0;
+    Write(writer);
+}
+
+/**
+ * @brief Queue the pending changes in time order
+ * 
+ * @param writer 
+ */
+void WaveformFile::Write(LogWriter& writer)
+{
+    merged.clear();
+
+    for (Signal& signal : signals)
+    {
+        merged.insert(merged.end(), signal.changes.begin(), signal.changes.end());
+        signal.changes.clear();
+    }
+
+    if (merged.empty())
+    {
+        return;
+    }
+
+    /* The changes of one signal keep their order */
+    std::stable_sort(merged.begin(), merged.end(),
+                     [](const Change& a, const Change& b) { return a.time < b.time; });
+
+    std::string chunk = writer.Acquire(*sink);
+    char text[80];
+
+    for (const Change& change : merged)
+    {
+        if (!has_time || change.time != last_time)
+        {
+            chunk += '#';
+            chunk.append(text, std::to_chars(text, text + sizeof(text), change.time).ptr);
+            chunk += '\n';
+            last_time = change.time;
+            has_time = true;
+        }
+
+        size_t width = widths[change.variable];
+
+        if (width == 1)
+        {
+            chunk += static_cast<char>('0' + (change.bits & 1));
+        }
+        else if (width == 0)
+        {
+            chunk += 'r';
+            chunk.append(text, std::to_chars(text, text + sizeof(text), std::bit_cast<double>(change.bits)).ptr);
+            chunk += ' ';
+        }
+        else
+        {
+            chunk += 'b';
+            chunk.append(text, std::to_chars(text, text + sizeof(text), change.bits, 2).ptr);
+            chunk += ' ';
+        }
+
+        chunk += identifiers[change.variable];
+        chunk += '\n';
+    }
+
+    writer.Write(*sink, std::move(chunk));
+}
+
+/**
+ * @brief Queue the last changes and close the file
+ * 
+ * @param writer 
+ */
+void WaveformFile::Close(LogWriter& writer)
+{
+    Write(writer);
+    writer.Close(*sink);
+}
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "abstract_handler.hpp"
+#include "log_writer.hpp"
+#include "time_accumulator.hpp"
+
+/*******************************************************************************
+* WAVEFORM FILE CLASS
+********************************************************************************/
+
+/**
+ * @brief Value Change Dump (VCD) file holding the logs of type waveform.
+ * 
+ * @details Each value of a signal (array element, real or imaginary part) is
+ * a VCD variable in the scopes of the signal hierarchy. Bool, integer and
+ * fixed point values are bit vectors and the rest are reals. Only the samples
+ * that change a value are kept, at the time of their clock edge in fs.
+ * @details Logs of different clock domains sample concurrently, each one in
+ * its own list of changes. Sync runs when every log has sampled up to the
+ * same time and writes the lists merged in time order.
+ */
+class WaveformFile
+{
+public:
+
+    using Ticks = TimeAccumulator::Ticks;
+
+    /* VCD time unit */
+    static constexpr Ticks TICKS_PER_FEMTOSECOND { TimeAccumulator::TICKS_PER_SECOND / 1000000000000000ULL };
+
+private:
+
+    /* Changes are written every SYNC_PERIOD syncs */
+    static constexpr size_t SYNC_PERIOD { 1024 };
+
+    struct Change
+    {
+        uint64_t time;
+        uint64_t bits;
+        size_t variable;
+    };
+
+    struct Signal
+    {
+        std::string name;
+        size_t width;
+        size_t n_values;
+        size_t size;
+        size_t first_variable;
+        std::vector<uint64_t> values;
+        std::vector<uint64_t> sample;
+        bool has_values;
+        std::vector<Change> changes;
+    };
+
+    std::vector<Signal> signals;
+    std::vector<size_t> widths;
+    std::vector<std::string> identifiers;
+    std::vector<Change> merged;
+    LogWriter::SinkPtr sink;
+    uint64_t last_time { 0 };
+    bool has_time { false };
+    size_t n_syncs { 0 };
+
+    static std::string GetIdentifier(size_t variable);
+    void Write(LogWriter& writer);
+
+public:
+
+    size_t AddSignal(const std::string& name, size_t width, size_t n_values, size_t size);
+    bool IsEmpty() const;
+    void Open(LogWriter& writer, const std::string& file_name);
+    void Sample(size_t signal, Ticks time, AbstractHandler& handler);
+    void Sync(LogWriter& writer);
+    void Close(LogWriter& writer);
+};
@@ -36,6 +36,7 @@
 * SOFTWARE.
 ********************************************************************************/
 
+#include <algorithm>
 #include <iomanip>
 #include <fstream>
 
@@ -78,6 +79,7 @@ void Module::Initialize(YAML::Node& settings)
     ConfigureRecursively(settings);
     CheckRecursively();
     OptimizeRecursively();
+    Elaborate();
     InitRecursively();
 }
 
@@ -280,6 +282,198 @@ void Module::Optimize()
     }
 }
 
+/**
+ * @brief Elaborate the combinational dependencies of the hierarchy. A module
+ * depends on the modules driving its ports through COMBINATIONAL_PORT. The
+ * modules are levelized so that clocks run them in dependency order and
+ * GetData() is a plain load. It only works for reflected ports.
+ * 
+ */
+void Module::Elaborate()
+{
+    /* Modules of the hierarchy */
+    std::vector<Module*> modules;
+    ParentsMap parents;
+    CollectRecursively(modules, parents);
+
+    auto is_submodule = [&parents](Module* module, Module* ancestor)
+    {
+        for (auto it = parents.find(module); it != parents.end(); it = parents.find(it->second))
+        {
+            if (it->second == ancestor)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    /* Combinational sources */
+    std::unordered_map<Module*, std::vector<Module*>> sinks;
+    PendingMap n_pending;
+    combinational_order.clear();
+
+    for (Module* module : modules)
+    {
+        std::vector<Module*> module_ptrs;
+        for (const auto& [key, ptr] : module->port_map)
+        {
+            ptr->GetModulePointers(module_ptrs);
+        }
+
+        bool drives_outputs = false;
+        module->combinational_sources.clear();
+        module->combinational_level = 0;
+
+        for (Module* source : module_ptrs)
+        {
+            /* Own outputs and outputs forwarded from sub-modules */
+            if (source == module || is_submodule(source, module))
+            {
+                drives_outputs = drives_outputs || (source == module);
+                continue;
+            }
+
+            if (parents.find(source) == parents.end())
+            {
+                std::string error_text = std::string(__FILE__) + ":"
+                                       + std::to_string(__LINE__) + ": "
+                                       + "ERROR [non-reflected combinational module]: "
+                                       + "a port of module <" + module->full_name + "> "
+                                       + "is driven by a module that is not reflected";
+                throw std::runtime_error(error_text);
+            }
+
+            auto &sources = module->combinational_sources;
+            if (std::find(sources.begin(), sources.end(), source) == sources.end())
+            {
+                sources.push_back(source);
+                sinks[source].push_back(module);
+            }
+        }
+
+        n_pending[module] = module->combinational_sources.size();
+
+        /* Fully combinational outputs are settled after every edge */
+        if (drives_outputs && module->IsFullyCombinational())
+        {
+            combinational_order.push_back(module);
+        }
+    }
+
+    /* Levelize: sources before sinks */
+    std::vector<Module*> ready;
+    size_t n_levelized { 0 };
+
+    for (Module* module : modules)
+    {
+        if (n_pending[module] == 0)
+        {
+            ready.push_back(module);
+        }
+    }
+
+    while (!ready.empty())
+    {
+        Module* module = ready.back();
+        ready.pop_back();
+        n_levelized++;
+
+        for (Module* sink : sinks[module])
+        {
+            sink->combinational_level = std::max(sink->combinational_level, module->combinational_level + 1);
+
+            if (--n_pending[sink] == 0)
+            {
+                ready.push_back(sink);
+            }
+        }
+    }
+
+    if (n_levelized != modules.size())
+    {
+        ReportCombinationalLoop(n_pending);
+    }
+
+    auto by_level = [](Module* a, Module* b)
+    {
+        return a->combinational_level < b->combinational_level;
+    };
+
+    std::stable_sort(combinational_order.begin(), combinational_order.end(), by_level);
+}
+
+/**
+ * @brief Collect this module and its sub-modules with their parents
+ * 
+ * @param modules 
+ * @param parents 
+ */
+void Module::CollectRecursively(std::vector<Module*>& modules, ParentsMap& parents)
+{
+    modules.push_back(this);
+    parents.try_emplace(this, nullptr);
+
+    for (const auto& [key, ptr] : module_map)
+    {
+        parents[ptr] = this;
+        ptr->CollectRecursively(modules, parents);
+    }
+}
+
+/**
+ * @brief Report a combinational loop among the modules left unresolved
+ * by the levelization
+ * 
+ * @param n_pending 
+ */
+void Module::ReportCombinationalLoop(PendingMap& n_pending)
+{
+    Module* module { nullptr };
+
+    for (const auto& [ptr, count] : n_pending)
+    {
+        if (count > 0)
+        {
+            module = ptr;
+            break;
+        }
+    }
+
+    /* Walk unresolved sources until a module repeats */
+    std::vector<Module*> path;
+
+    while (std::find(path.begin(), path.end(), module) == path.end())
+    {
+        path.push_back(module);
+
+        for (Module* source : module->combinational_sources)
+        {
+            if (n_pending[source] > 0)
+            {
+                module = source;
+                break;
+            }
+        }
+    }
+
+    /* Loop in data flow order */
+    std::string loop_text;
+    auto first = std::find(path.begin(), path.end(), module);
+
+    for (auto it = path.end(); it != first; it--)
+    {
+        loop_text += "<" + (*(it - 1))->full_name + "> -> ";
+    }
+    loop_text += "<" + path.back()->full_name + ">";
+
+    std::string error_text = std::string(__FILE__) + ":"
+                           + std::to_string(__LINE__) + ": "
+                           + "ERROR [combinational loop]: "
+                           + loop_text;
+    throw std::runtime_error(error_text);
+}
+
 /**
  * @brief Initializes modules recursively
  * 
@@ -449,6 +643,43 @@ void Module::PrintBigMap() const
               << std::endl;
 }
 
+/**
+ * @brief Collect this module and its sub-modules
+ * 
+ * @param modules 
+ */
+void Module::GetModules(std::vector<Module*>& modules)
+{
+    ParentsMap parents;
+    CollectRecursively(modules, parents);
+}
+
+/**
+ * @brief Collect the reflected ports of this module
+ * 
+ * @param port_ptrs 
+ */
+void Module::GetPorts(std::vector<AbstractPort*>& port_ptrs) const
+{
+    for (const auto& [key, ptr] : port_map)
+    {
+        port_ptrs.push_back(ptr);
+    }
+}
+
+/**
+ * @brief Collect the reflected registers of this module
+ * 
+ * @param register_ptrs 
+ */
+void Module::GetRegisters(std::vector<AbstractRegister*>& register_ptrs) const
+{
+    for (const auto& [key, ptr] : reg_map)
+    {
+        register_ptrs.push_back(ptr);
+    }
+}
+
 /**
  * @brief Set the Master execution done
  *  
@@ -500,4 +731,25 @@ bool Module::IsSequentialOrMixed() const
 bool Module::IsFullyCombinational() const
 {
     return (logic_type == LogicType::FullyCombinational);
+}
+
+const std::vector<Module*>& Module::GetCombinationalSources() const
+{
+    return combinational_sources;
+}
+
+/**
+ * @brief Fully combinational modules driving outputs, in level order.
+ * Only filled in the root module.
+ * 
+ * @return const std::vector<Module*>& 
+ */
+const std::vector<Module*>& Module::GetCombinationalOrder() const
+{
+    return combinational_order;
+}
+
+size_t Module::GetCombinationalLevel() const
+{
+    return combinational_level;
 }
\ No newline at end of file
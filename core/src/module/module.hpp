@@ -42,7 +42,10 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <iosfwd>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 /*******************************************************************************
 * LOCAL HEADERS
@@ -91,6 +94,18 @@ private:
     enum LogicType {SequentialOrMixed = true, FullyCombinational = false};
     bool logic_type { LogicType::FullyCombinational };
 
+    /* Combinational elaboration */
+    using ParentsMap = std::unordered_map<Module*, Module*>;
+    using PendingMap = std::unordered_map<Module*, size_t>;
+    
+    std::vector<Module*> combinational_sources;
+    std::vector<Module*> combinational_order;
+    size_t combinational_level { 0 };
+
+    void Elaborate();
+    void CollectRecursively(std::vector<Module*>& modules, ParentsMap& parents);
+    void ReportCombinationalLoop(PendingMap& n_pending);
+
     /* Export settings methods */
     YAML::Node CreateSettingsYAMLNodeRecursively();
     YAML::Node OverrideSettings(YAML::Node news, YAML::Node olds);
@@ -113,6 +128,9 @@ public:
 
     /* Module and submodules hierarchy */
     void PrintBigMap() const;
+    void GetModules(std::vector<Module*>& modules);
+    void GetPorts(std::vector<AbstractPort*>& port_ptrs) const;
+    void GetRegisters(std::vector<AbstractRegister*>& register_ptrs) const;
 
     /* Export file methods */
     void ExportSettingsFile(std::string settings_file);
@@ -123,6 +141,14 @@ public:
     virtual void Connect() = 0;
     virtual void RunClockMaster() = 0;
 
+    /* Called when settings change after Init(), to update what depends on them.
+       False if the module can not take new settings */
+    virtual bool Reconfigure() { return false; }
+
+    /* State that is not reflected, e.g. random engines, for checkpoints */
+    virtual void SaveState([[maybe_unused]] std::ostream& stream) const {}
+    virtual void RestoreState([[maybe_unused]] std::istream& stream) {}
+
     /* RunClockMaster() status interface */
     void SetMasterAsDone();
     void SetMasterAsNotDone();
@@ -134,4 +160,9 @@ public:
     void SeAsFullyCombinational();
     bool IsSequentialOrMixed() const;
     bool IsFullyCombinational() const;
+
+    /* Combinational elaboration interface */
+    const std::vector<Module*>& GetCombinationalSources() const;
+    const std::vector<Module*>& GetCombinationalOrder() const;
+    size_t GetCombinationalLevel() const;
 };
\ No newline at end of file
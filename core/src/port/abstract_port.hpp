@@ -42,14 +42,39 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
 
+#include "abstract_channel.hpp"
 #include "basic_reflection.hpp"
 
+/*******************************************************************************
+* FORWARD DECLARATIONS
+********************************************************************************/
+
+class Module;
+class AbstractPort;
+
+/*******************************************************************************
+* PORT LINK STRUCT
+********************************************************************************/
+
+/**
+ * @brief Data pointed to by a single port after the optimization. A linked
+ * port reached it through other ports, otherwise the port owns the link.
+ */
+struct PortLink
+{
+    AbstractPort* port;
+    const void* data;
+    bool is_linked;
+};
+
 /*******************************************************************************
 * ABSTRACT PORT CLASS
 ********************************************************************************/
@@ -62,5 +87,10 @@ public:
 
     virtual bool IsNull() = 0;
     virtual bool Optimize() = 0;
+    virtual void GetModulePointers(std::vector<Module*>& module_ptrs) = 0;
     virtual AbstractHandlerPtr GetHandlerPointer() = 0;
+
+    /* Clock domains */
+    virtual void GetLinks(std::vector<PortLink>& links) = 0;
+    virtual std::unique_ptr<AbstractChannel> Decouple(size_t capacity) = 0;
 };
\ No newline at end of file
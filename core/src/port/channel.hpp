@@ -0,0 +1,113 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "abstract_channel.hpp"
+#include "spsc_queue.hpp"
+
+/*******************************************************************************
+* CHANNEL CLASS
+********************************************************************************/
+
+/**
+ * @brief Boundary channel of a port. The consumer port points to the mirror,
+ * which is only written by the consumer domain.
+ */
+template<typename T>
+class Channel : public AbstractChannel
+{
+private:
+
+    struct Sample
+    {
+        Ticks time;
+        T value;
+    };
+
+    const T* source;
+    T mirror;
+    SpscQueue<Sample> queue;
+
+public:
+
+    Channel(const T* source_ptr, size_t capacity);
+
+    T* GetMirror();
+
+    bool Publish(Ticks time) override;
+    void Consume(Ticks time) override;
+};
+
+template<typename T>
+Channel<T>::Channel(const T* source_ptr, size_t capacity)
+    : source(source_ptr), mirror(*source_ptr), queue(capacity)
+{
+}
+
+template<typename T>
+T* Channel<T>::GetMirror()
+{
+    return &mirror;
+}
+
+template<typename T>
+bool Channel<T>::Publish(Ticks time)
+{
+    return queue.Push({time, *source});
+}
+
+template<typename T>
+void Channel<T>::Consume(Ticks time)
+{
+    for (Sample* sample = queue.Front(); sample && sample->time < time; sample = queue.Front())
+    {
+        mirror = sample->value;
+        queue.Pop();
+    }
+}
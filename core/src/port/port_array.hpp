@@ -44,6 +44,7 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 /*******************************************************************************
 * LOCAL HEADERS
@@ -84,6 +85,11 @@ public:
     /* Verification and Optimization */
     bool IsNull() override;
     bool Optimize() override;
+    void GetModulePointers(std::vector<Module*>& module_ptrs) override;
+
+    /* Clock domains */
+    void GetLinks(std::vector<PortLink>& links) override;
+    std::unique_ptr<AbstractChannel> Decouple(size_t capacity) override;
     
     /* Handler */
     std::shared_ptr<AbstractHandler> GetHandlerPointer() override;
@@ -171,6 +177,31 @@ bool Port<T, N>::Optimize()
     return this->IsNull();
 }
 
+template<typename T, size_t N>
+void Port<T, N>::GetModulePointers(std::vector<Module*>& module_ptrs)
+{
+    for (size_t i { 0 }; i < N; i++)
+    {
+        ports[i].GetModulePointers(module_ptrs);
+    }
+}
+
+template<typename T, size_t N>
+void Port<T, N>::GetLinks(std::vector<PortLink>& links)
+{
+    for (size_t i { 0 }; i < N; i++)
+    {
+        ports[i].GetLinks(links);
+    }
+}
+
+template<typename T, size_t N>
+std::unique_ptr<AbstractChannel> Port<T, N>::Decouple([[maybe_unused]] size_t capacity)
+{
+    /* The elements are decoupled one by one through GetLinks() */
+    return nullptr;
+}
+
 /*******************************************************************************
 * SPECIALIZATIONS
 ********************************************************************************/
@@ -38,10 +38,17 @@
 
 #pragma once
 
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <type_traits>
+
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
 
+#include "channel.hpp"
 #include "port_array.hpp"
 #include "module.hpp"
 
@@ -71,6 +78,7 @@ private:
 
     /* Control variables */
     bool p_data_is_dynamic { false };
+    bool p_data_is_linked { false };
 
 public:
 
@@ -108,6 +116,11 @@ public:
     /* Verification and Optimization */
     bool IsNull() override;
     bool Optimize() override;
+    void GetModulePointers(std::vector<Module*>& module_ptrs) override;
+
+    /* Clock domains */
+    void GetLinks(std::vector<PortLink>& links) override;
+    std::unique_ptr<AbstractChannel> Decouple(size_t capacity) override;
 
     /* Handler */
     std::shared_ptr<AbstractHandler> GetHandlerPointer() override;
@@ -131,20 +144,13 @@ T Port<T, 1>::GetData()
         return p_port->GetData();
     }
 
-    /* Combinational Port */
-    if (p_module && (p_module->IsFullyCombinational() || p_module->IsMasterNotDone()))
-    {   
-        p_module->RunClockMaster();
-        p_module->SetMasterAsDone();
-    }
-
     /* Port without connection return 0 by default */
     if (p_data == nullptr)
     {
         return static_cast<T>(0);
     }
 
-    /* Port pointing to data */
+    /* Port pointing to data: combinational modules are run by the clocks */
     return *(p_data);
 }
 
@@ -251,6 +257,7 @@ bool Port<T, 1>::Optimize()
     /* Back trace ports */
     p_module = GetModulePointer();
     p_data = GetDataPointer();
+    p_data_is_linked = p_data_is_linked || (p_port != nullptr);
     
     /* Set as first port */
     p_port = nullptr;
@@ -258,6 +265,40 @@ bool Port<T, 1>::Optimize()
     return IsNull();
 }
 
+template<typename T>
+void Port<T, 1>::GetModulePointers(std::vector<Module*>& module_ptrs)
+{
+    Module* module_ptr = GetModulePointer();
+
+    if (module_ptr)
+    {
+        module_ptrs.push_back(module_ptr);
+    }
+}
+
+template<typename T>
+void Port<T, 1>::GetLinks(std::vector<PortLink>& links)
+{
+    links.push_back({this, p_data, p_data_is_linked});
+}
+
+template<typename T>
+std::unique_ptr<AbstractChannel> Port<T, 1>::Decouple([[maybe_unused]] size_t capacity)
+{
+    /* Clocks and other polymorphic objects are not copied between domains */
+    if constexpr (!std::is_polymorphic_v<T>)
+    {
+        if (p_data != nullptr)
+        {
+            auto channel = std::make_unique<Channel<T>>(p_data, capacity);
+            p_data = channel->GetMirror();
+            return channel;
+        }
+    }
+
+    return nullptr;
+}
+
 /*******************************************************************************
 * HANDLER SPECIALIZATIONS
 ********************************************************************************/
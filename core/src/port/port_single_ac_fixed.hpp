@@ -42,6 +42,7 @@
 * LOCAL HEADERS
 ********************************************************************************/
 
+#include "channel.hpp"
 #include "port_array.hpp"
 #include "ac_fixed.h"
 
@@ -61,6 +62,7 @@ private:
 
     /* Control variables */
     bool p_data_is_dynamic { false };
+    bool p_data_is_linked { false };
 
 public:
 
@@ -98,6 +100,11 @@ public:
     /* Verification and Optimization */
     bool IsNull() override;
     bool Optimize() override;
+    void GetModulePointers(std::vector<Module*>& module_ptrs) override;
+
+    /* Clock domains */
+    void GetLinks(std::vector<PortLink>& links) override;
+    std::unique_ptr<AbstractChannel> Decouple(size_t capacity) override;
 
     /* Handler */
     std::shared_ptr<AbstractHandler> GetHandlerPointer() override;
@@ -121,20 +128,13 @@ ac_fixed<W, I, S, Q, O> Port<ac_fixed<W, I, S, Q, O>, 1>::GetData()
         return p_port->GetData();
     }
 
-    /* Combinational Port */
-    if (p_module && (p_module->IsFullyCombinational() || p_module->IsMasterNotDone()))
-    {   
-        p_module->RunClockMaster();
-        p_module->SetMasterAsDone();
-    }
-
     /* Port without connection return 0 by default */
     if (p_data == nullptr)
     {
         return 0;
     }
 
-    /* Port pointing to data */
+    /* Port pointing to data: combinational modules are run by the clocks */
     return *(p_data);
 }
 
@@ -241,6 +241,7 @@ bool Port<ac_fixed<W, I, S, Q, O>, 1>::Optimize()
     /* Back trace ports */
     p_module = GetModulePointer();
     p_data = GetDataPointer();
+    p_data_is_linked = p_data_is_linked || (p_port != nullptr);
     
     /* Set as first port */
     p_port = nullptr;
@@ -248,6 +249,36 @@ bool Port<ac_fixed<W, I, S, Q, O>, 1>::Optimize()
     return IsNull();
 }
 
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Port<ac_fixed<W, I, S, Q, O>, 1>::GetModulePointers(std::vector<Module*>& module_ptrs)
+{
+    Module* module_ptr = GetModulePointer();
+
+    if (module_ptr)
+    {
+        module_ptrs.push_back(module_ptr);
+    }
+}
+
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+void Port<ac_fixed<W, I, S, Q, O>, 1>::GetLinks(std::vector<PortLink>& links)
+{
+    links.push_back({this, p_data, p_data_is_linked});
+}
+
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+std::unique_ptr<AbstractChannel> Port<ac_fixed<W, I, S, Q, O>, 1>::Decouple(size_t capacity)
+{
+    if (p_data == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto channel = std::make_unique<Channel<ac_fixed<W, I, S, Q, O>>>(p_data, capacity);
+    p_data = channel->GetMirror();
+    return channel;
+}
+
 /*******************************************************************************
 * HANDLER GETTER
 ********************************************************************************/
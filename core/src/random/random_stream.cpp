@@ -0,0 +1,173 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cmath>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "random_stream.hpp"
+
+/*******************************************************************************
+* RANDOM STREAM CLASS
+********************************************************************************/
+
+/**
+ * @brief Key of the stream, from the seed and the full name of the module, so
+ * modules with the same seed draw different values.
+ * 
+ * @param seed 
+ * @param name 
+ */
+void RandomStream::Init(uint64_t seed, const std::string& name)
+{
+    /* FNV-1a of the name */
+    uint64_t hash { 0xCBF29CE484222325 };
+    for (char c : name)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001B3;
+    }
+
+    uint64_t value = Mix(hash ^ Mix(seed));
+    key = { static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32) };
+}
+
+/**
+ * @brief SplitMix64 finalizer
+ * 
+ * @param value 
+ * @return uint64_t 
+ */
+uint64_t RandomStream::Mix(uint64_t value)
+{
+    value += 0x9E3779B97F4A7C15;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Uniform values in [0, 1), two per block, with 53 random bits
+ * 
+ * @param index 
+ * @param values 
+ * @param n 
+ */
+void RandomStream::Uniform(uint64_t index, double* values, size_t n) const
+{
+    for (size_t i = 0; i < n; i += 2)
+    {
+        Counter bits = Generate(index, i / 2);
+
+        for (size_t j = 0; j < 2 && i + j < n; j++)
+        {
+            uint64_t word = (static_cast<uint64_t>(bits[2 * j + 1]) << 32) | bits[2 * j];
+            values[i + j] = static_cast<double>(word >> 11) * 0x1.0p-53;
+        }
+    }
+}
+
+/**
+ * @brief Integers in [0, bound), four per block. Multiply and shift, whose
+ * bias (below bound / 2^32) is negligible for the bounds of a module.
+ * 
+ * @param index 
+ * @param bound 
+ * @param values 
+ * @param n 
+ */
+void RandomStream::Integer(uint64_t index, uint32_t bound, uint32_t* values, size_t n) const
+{
+    for (size_t i = 0; i < n; i += 4)
+    {
+        Counter bits = Generate(index, i / 4);
+
+        for (size_t j = 0; j < 4 && i + j < n; j++)
+        {
+            values[i + j] = static_cast<uint32_t>((static_cast<uint64_t>(bits[j]) * bound) >> 32);
+        }
+    }
+}
+
+/**
+ * @brief Standard normal values, two per accepted block with the polar
+ * method. The rejected blocks are skipped, so the values of an index are
+ * still the same whatever n.
+ * 
+ * @param index 
+ * @param values 
+ * @param n 
+ */
+void RandomStream::Gaussian(uint64_t index, double* values, size_t n) const
+{
+    uint64_t block = 0;
+
+    for (size_t i = 0; i < n; i += 2)
+    {
+        double x;
+        double y;
+        double radius;
+
+        /* Point in the unit circle, 79 % of the blocks */
+        do
+        {
+            Counter bits = Generate(index, block++);
+
+            uint64_t word_0 = (static_cast<uint64_t>(bits[1]) << 32) | bits[0];
+            uint64_t word_1 = (static_cast<uint64_t>(bits[3]) << 32) | bits[2];
+
+            x = static_cast<double>(word_0 >> 11) * 0x1.0p-52 - 1.0;
+            y = static_cast<double>(word_1 >> 11) * 0x1.0p-52 - 1.0;
+            radius = x * x + y * y;
+        } while (!(radius > 0.0 && radius < 1.0));
+
+        double scale = std::sqrt(-2.0 * std::log(radius) / radius);
+
+        values[i] = x * scale;
+        if (i + 1 < n)
+        {
+            values[i + 1] = y * scale;
+        }
+    }
+}
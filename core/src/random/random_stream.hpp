@@ -0,0 +1,130 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*******************************************************************************
+* RANDOM STREAM CLASS
+********************************************************************************/
+
+/**
+ * @brief Counter-based random numbers (Philox4x32-10).
+ *
+ * @details The draws are a function of the seed, the full name of the module
+ * and an index, usually the tick of its clock: there is no generator state.
+ * The same run gives the same values with any number of threads, domains or
+ * simulators, a checkpoint doesn't need to save them, and any tick can be
+ * drawn without the ones before it.
+ *
+ * Each block call fills n values of an index; value k of an index doesn't
+ * depend on n.
+ */
+class RandomStream
+{
+public:
+
+    using Counter = std::array<uint32_t, 4>;
+    using Key = std::array<uint32_t, 2>;
+
+private:
+
+    Key key { 0, 0 };
+
+    /* Philox4x32 constants */
+    static constexpr uint32_t MULTIPLIER_0 { 0xD2511F53 };
+    static constexpr uint32_t MULTIPLIER_1 { 0xCD9E8D57 };
+    static constexpr uint32_t WEYL_0 { 0x9E3779B9 };
+    static constexpr uint32_t WEYL_1 { 0xBB67AE85 };
+    static constexpr int N_ROUNDS { 10 };
+
+    static uint64_t Mix(uint64_t value);
+
+public:
+
+    void Init(uint64_t seed, const std::string& name);
+
+    /* Raw block: 128 random bits of block of an index */
+    inline Counter Generate(uint64_t index, uint64_t block) const;
+    static inline Counter Philox(Counter counter, Key round_key);
+
+    /* Blocks of values of an index */
+    void Uniform(uint64_t index, double* values, size_t n) const;
+    void Integer(uint64_t index, uint32_t bound, uint32_t* values, size_t n) const;
+    void Gaussian(uint64_t index, double* values, size_t n) const;
+};
+
+/**
+ * @brief Philox4x32-10 bijection of a counter under a key
+ * 
+ * @param counter 
+ * @param round_key 
+ * @return RandomStream::Counter 
+ */
+inline RandomStream::Counter RandomStream::Philox(Counter counter, Key round_key)
+{
+    for (int round = 0; round < N_ROUNDS; round++)
+    {
+        uint64_t product_0 = static_cast<uint64_t>(MULTIPLIER_0) * counter[0];
+        uint64_t product_1 = static_cast<uint64_t>(MULTIPLIER_1) * counter[2];
+
+        counter = { static_cast<uint32_t>(product_1 >> 32) ^ counter[1] ^ round_key[0],
+                    static_cast<uint32_t>(product_1),
+                    static_cast<uint32_t>(product_0 >> 32) ^ counter[3] ^ round_key[1],
+                    static_cast<uint32_t>(product_0) };
+
+        round_key[0] += WEYL_0;
+        round_key[1] += WEYL_1;
+    }
+
+    return counter;
+}
+
+inline RandomStream::Counter RandomStream::Generate(uint64_t index, uint64_t block) const
+{
+    return Philox({ static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+                    static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32) }, key);
+}
@@ -36,4 +36,14 @@
 * SOFTWARE.
 ********************************************************************************/
 
-#include "abstract_register.hpp"
\ No newline at end of file
+#include "abstract_register.hpp"
+
+/**
+ * @brief Registers that are not trivially copyable commit through RunClock().
+ *
+ * @return false
+ */
+bool AbstractRegister::GetCommitRange([[maybe_unused]] CommitRange& range)
+{
+    return false;
+}
\ No newline at end of file
@@ -38,8 +38,22 @@
 
 #pragma once
 
+#include <cstddef>
+#include <iosfwd>
+
 #include "basic_reflection.hpp"
 
+/**
+ * @brief Memory copied by RunClock() when the output is a plain copy of the input
+ * 
+ */
+struct CommitRange
+{
+    void* output;
+    const void* input;
+    size_t bytes;
+};
+
 /**
  * @brief Register base class
  * 
@@ -54,4 +68,9 @@ public:
     virtual void RunClock() = 0;
     virtual void Reset() = 0;
     virtual void Set() = 0;
+    virtual bool GetCommitRange(CommitRange& range);
+
+    /* State that is not reflected, for checkpoints */
+    virtual void SaveState([[maybe_unused]] std::ostream& stream) const {}
+    virtual void RestoreState([[maybe_unused]] std::istream& stream) {}
 };
\ No newline at end of file
@@ -0,0 +1,245 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "abstract_register.hpp"
+#include "checkpoint.hpp"
+
+/**
+ * @brief Delay line register: the last N samples pushed to the input,
+ * newest first. Samples are kept twice in a mirror buffer of 2N elements,
+ * so a commit only moves the head index and writes two elements, and the
+ * whole line is always a contiguous window that MAC loops can vectorize.
+ * 
+ * The input `i` is pushed on the next edge only if Push() was called in
+ * the master; otherwise the line keeps its content, like a register whose
+ * input was not written.
+ * 
+ * @tparam T
+ * @tparam N
+ */
+template <typename T, size_t N>
+class DelayLine : public AbstractRegister
+{
+    static_assert(N > 0, "a delay line must hold at least one sample");
+
+public:
+
+    /**
+     * @brief Read-only view of the line: element k is the sample pushed k + 1 edges ago
+     */
+    class View
+    {
+    private:
+
+        friend class DelayLine;
+        const T* window { nullptr };
+
+    public:
+
+        const T& operator[](size_t k) const { return window[k]; }
+        const T* data() const { return window; }
+        const T* begin() const { return window; }
+        const T* end() const { return window + N; }
+        static constexpr size_t size() { return N; }
+    };
+
+    T i { 0 };
+    View o;
+
+    DelayLine();
+    DelayLine(T data);
+    DelayLine(const DelayLine&) = delete;
+    DelayLine& operator=(const DelayLine&) = delete;
+
+    void Push(T data);
+    void RunClock() override;
+    void Reset() override;
+    void Set() override;
+    void Set(T data);
+
+    void SaveState(std::ostream& stream) const override;
+    void RestoreState(std::istream& stream) override;
+
+private:
+
+    std::array<T, 2 * N> buffer {};
+    size_t head { 0 };
+    bool pushed { false };
+
+    /* Handler of the reflected output, moved with the window */
+    AbstractHandlerPtr o_handler;
+
+    void Fill(T data);
+    void UpdateWindow();
+};
+
+template <class T, size_t N>
+DelayLine<T, N>::DelayLine() : DelayLine(0)
+{
+}
+
+template <class T, size_t N>
+DelayLine<T, N>::DelayLine(T data)
+{
+    /* Reflected as a plain register: input sample and output array */
+    REFLECT(i);
+    this->Reflect("o", *reinterpret_cast<std::array<T, N>*>(buffer.data()));
+    o_handler = this->h_variable_map["o"];
+
+    Fill(data);
+}
+
+/**
+ * @brief Sets the sample pushed into the line on the next edge.
+ *
+ * @tparam T The data type.
+ * @tparam N Line length.
+ * @param data Input sample.
+ */
+template <class T, size_t N>
+void DelayLine<T, N>::Push(T data)
+{
+    this->i = data;
+    pushed = true;
+}
+
+/**
+ * @brief Advances the line on a clock cycle if a sample was pushed.
+ *
+ * @tparam T The data type.
+ * @tparam N Line length.
+ */
+template <class T, size_t N>
+void DelayLine<T, N>::RunClock()
+{
+    if (!pushed)
+    {
+        return;
+    }
+
+    head = (head == 0) ? N - 1 : head - 1;
+    buffer[head] = this->i;
+    buffer[head + N] = this->i;
+    pushed = false;
+
+    UpdateWindow();
+}
+
+/**
+ * @brief Resets the input and every sample of the line to 0.
+ *
+ * @tparam T The data type.
+ * @tparam N Line length.
+ */
+template <class T, size_t N>
+void DelayLine<T, N>::Reset()
+{
+    Fill(0);
+}
+
+/**
+ * @brief Sets the input and every sample of the line to 1.
+ *
+ * @tparam T The data type.
+ * @tparam N Line length.
+ */
+template <class T, size_t N>
+void DelayLine<T, N>::Set()
+{
+    Fill(1);
+}
+
+/**
+ * @brief Sets the input and every sample of the line to the provided value.
+ *
+ * @tparam T The data type.
+ * @tparam N Line length.
+ * @param data The value to set.
+ */
+template <class T, size_t N>
+void DelayLine<T, N>::Set(T data)
+{
+    Fill(data);
+}
+
+/**
+ * @brief Saves the samples of the line and its position.
+ *
+ * @tparam T The data type.
+ * @tparam N Line length.
+ * @param stream
+ */
+template <class T, size_t N>
+void DelayLine<T, N>::SaveState(std::ostream& stream) const
+{
+    Checkpoint::Write(stream, buffer);
+    Checkpoint::Write(stream, head);
+    Checkpoint::Write(stream, pushed);
+}
+
+template <class T, size_t N>
+void DelayLine<T, N>::RestoreState(std::istream& stream)
+{
+    Checkpoint::Read(stream, buffer);
+    Checkpoint::Read(stream, head);
+    Checkpoint::Read(stream, pushed);
+
+    UpdateWindow();
+}
+
+template <class T, size_t N>
+void DelayLine<T, N>::Fill(T data)
+{
+    this->i = data;
+    buffer.fill(data);
+    head = 0;
+    pushed = false;
+
+    UpdateWindow();
+}
+
+template <class T, size_t N>
+void DelayLine<T, N>::UpdateWindow()
+{
+    o.window = buffer.data() + head;
+    o_handler->SetPointer(buffer.data() + head);
+}
@@ -39,4 +39,5 @@
 #pragma once
 
 #include "register_array.hpp"
-#include "register_single.hpp"
\ No newline at end of file
+#include "register_single.hpp"
+#include "delay_line.hpp"
\ No newline at end of file
@@ -38,6 +38,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "abstract_register.hpp"
 
 /**
@@ -63,6 +65,7 @@ public:
     Register(std::array<T, N>& data);
 
     void RunClock();
+    bool GetCommitRange(CommitRange& range);
     void Reset();
     void Reset(size_t idx);
     void Set();
@@ -215,4 +218,27 @@ template <class T, size_t N>
 void Register<T, N>::RunClock()
 {
     this->o = this->i;
+}
+
+/**
+ * @brief Memory range copied by RunClock(), so that register banks can
+ * commit trivially copyable registers without a virtual call.
+ *
+ * @tparam T The data type.
+ * @tparam N Array Length.
+ * @param range Output, input and size of the copy.
+ * @return true if the commit is a plain copy.
+ */
+template <class T, size_t N>
+bool Register<T, N>::GetCommitRange([[maybe_unused]] CommitRange& range)
+{
+    if constexpr (std::is_trivially_copyable_v<std::array<T, N>>)
+    {
+        range = {&this->o, &this->i, sizeof(std::array<T, N>)};
+        return true;
+    }
+    else
+    {
+        return false;
+    }
 }
\ No newline at end of file
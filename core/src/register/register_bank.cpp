@@ -0,0 +1,137 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "register_bank.hpp"
+
+/*******************************************************************************
+* REGISTER BANK CLASS
+********************************************************************************/
+
+void RegisterBank::Clear()
+{
+    for (auto &copies : fixed_ranges)
+    {
+        copies.clear();
+    }
+
+    ranges.clear();
+    registers.clear();
+}
+
+void RegisterBank::Add(AbstractRegister* reg_ptr)
+{
+    CommitRange range {};
+
+    if (!reg_ptr->GetCommitRange(range))
+    {
+        registers.push_back(reg_ptr);
+        return;
+    }
+
+    for (size_t i {0}; i < N_FIXED_SIZES; i++)
+    {
+        if (range.bytes == (size_t {1} << i))
+        {
+            fixed_ranges[i].push_back(range);
+            return;
+        }
+    }
+
+    ranges.push_back(range);
+}
+
+/**
+ * @brief Sorts the copies by address, so that a commit walks memory forward.
+ */
+void RegisterBank::Freeze()
+{
+    auto by_address = [](const CommitRange& a, const CommitRange& b)
+    {
+        return std::less<void*>()(a.output, b.output);
+    };
+
+    for (auto &copies : fixed_ranges)
+    {
+        std::sort(copies.begin(), copies.end(), by_address);
+        copies.shrink_to_fit();
+    }
+
+    std::sort(ranges.begin(), ranges.end(), by_address);
+    ranges.shrink_to_fit();
+    registers.shrink_to_fit();
+}
+
+template <size_t BYTES>
+void RegisterBank::Copy(const std::vector<CommitRange>& copies)
+{
+    for (auto &range : copies)
+    {
+        std::memcpy(range.output, range.input, BYTES);
+    }
+}
+
+void RegisterBank::Commit()
+{
+    Copy<1>(fixed_ranges[0]);
+    Copy<2>(fixed_ranges[1]);
+    Copy<4>(fixed_ranges[2]);
+    Copy<8>(fixed_ranges[3]);
+    Copy<16>(fixed_ranges[4]);
+    Copy<32>(fixed_ranges[5]);
+
+    for (auto &range : ranges)
+    {
+        std::memcpy(range.output, range.input, range.bytes);
+    }
+
+    for (auto &reg_ptr : registers)
+    {
+        reg_ptr->RunClock();
+    }
+}
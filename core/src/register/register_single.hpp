@@ -61,6 +61,7 @@ public:
     Register(T data);
 
     void RunClock() override;
+    bool GetCommitRange(CommitRange& range) override;
     void Reset() override;
     void Set() override;
     void Set(T data);
@@ -127,4 +128,26 @@ template <class T>
 void Register<T, 1>::RunClock()
 {
     this->o = this->i;
+}
+
+/**
+ * @brief Memory range copied by RunClock(), so that register banks can
+ * commit trivially copyable registers without a virtual call.
+ *
+ * @tparam T The data type.
+ * @param range Output, input and size of the copy.
+ * @return true if the commit is a plain copy.
+ */
+template <class T>
+bool Register<T, 1>::GetCommitRange([[maybe_unused]] CommitRange& range)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        range = {&this->o, &this->i, sizeof(T)};
+        return true;
+    }
+    else
+    {
+        return false;
+    }
 }
\ No newline at end of file
@@ -36,6 +36,15 @@
 * SOFTWARE.
 ********************************************************************************/
 
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
@@ -46,84 +55,581 @@
 * SCHEDULER CLASS
 ********************************************************************************/
 
-void Scheduler::Init()
+void Scheduler::Init(const std::vector<Clock*>& clocks, bool replay, size_t n_threads, const std::vector<Module*>& combinational_order)
 {
     /* Memory allocation */
-    clocks.reserve(Clock::instances.size());
+    queue.reserve(clocks.size());
+    next_clocks.reserve(clocks.size());
+    fired_clocks.reserve(clocks.size());
 
-    /* Sort all Clock instances*/
-    auto sorter = [](Clock* A, Clock* B)
+    /* Queue the clocks */
+    for(auto &clock : clocks)
     {
-        return A->GetNextEdgeTime() < B->GetNextEdgeTime();
-    };
-    
-    for(auto &clock : Clock::instances)
-    {
-        clocks.insert(std::lower_bound(clocks.begin(), clocks.end(), clock, sorter), clock);
+        Push(clock);
+        clock->period_changed = &period_changed;
     }
 
-    /* Free memory */
-    Clock::instances.clear();
-    Clock::instances.shrink_to_fit();
+    /* Worker threads for the masters */
+    thread_pool.Init(n_threads);
+
+    /* Settle combinational outputs before the first edge */
+    combinational_modules = combinational_order;
+    ElaborateSettleLists(clocks);
+    SettleCombinational();
+
+    /* Record the schedule if the clock tree has a short hyper-period */
+    if (replay && ComputeHyperPeriod())
+    {
+        mode = RECORDING;
+    }
 }
 
 void Scheduler::RunClocks()
 {
     /* Clock master */
-    for (Clock* clock : next_clocks)
+    if (thread_pool.GetThreadCount() > 1)
+    {
+        RunMastersParallel();
+    }
+    else
     {
-        clock->RunClockMaster();
+        for (Clock* clock : next_clocks)
+        {
+            clock->RunClockMaster();
+        }
     }
 
     /* Clock slave */
+    settle_batch.clear();
+
     for (Clock* clock : next_clocks)
     {
+        const Clock::EdgeTable& table = (clock->state == Clock::HIGH) ? clock->negedge_table : clock->posedge_table;
+        settle_batch.insert(settle_batch.end(), table.settle.begin(), table.settle.end());
+
         clock->RunClockSlave();
         clock->Update();
     }
 
-    /* Sort clocks */
-    auto sorter = [](Clock* A, Clock* B)
+    /* Combinational outputs on the new register values, once each */
+    if (next_clocks.size() > 1)
     {
-        return A->GetNextEdgeTime() < B->GetNextEdgeTime();
-    };
+        auto by_level = [](Module* a, Module* b)
+        {
+            size_t level_a = a->GetCombinationalLevel();
+            size_t level_b = b->GetCombinationalLevel();
+            return (level_a != level_b) ? level_a < level_b : a < b;
+        };
+
+        std::sort(settle_batch.begin(), settle_batch.end(), by_level);
+        settle_batch.erase(std::unique(settle_batch.begin(), settle_batch.end()), settle_batch.end());
+    }
+
+    for (Module* module : settle_batch)
+    {
+        module->RunClockMaster();
+    }
 
-    std::sort(clocks.begin(), clocks.end(), sorter);
+    /* A period changed: the recorded schedule is no longer valid */
+    if (period_changed && mode != DYNAMIC)
+    {
+        Fallback();
+        return;
+    }
+
+    /* Replay: the heap is not used */
+    if (mode == REPLAY)
+    {
+        return;
+    }
+
+    /* Re-key fired clocks: they are the top of the heap, children first */
+    for (auto it = fired_clocks.rbegin(); it != fired_clocks.rend(); it++)
+    {
+        Event &event = queue[(*it)->scheduler_index];
+        event.time = event.clock->next_edge_ticks;
+        SiftDown((*it)->scheduler_index);
+    }
+
+    /* Re-key derived clocks without an edge now */
+    for (Clock* clock : fired_clocks)
+    {
+        RekeyDerived(clock);
+    }
 }
 
 void Scheduler::UpdateNextClocks()
 {
-    long double next_edge_time = clocks.front()->GetNextEdgeTime();
-    unsigned int front_count { 0 };
+    /* Replay: next group of the recorded hyper-period */
+    if (mode == REPLAY)
+    {
+        replay_index = (replay_index + 2 < replay_groups.size()) ? replay_index + 1 : 0;
+        next_clocks.assign(replay_clocks.data() + replay_groups[replay_index], replay_clocks.data() + replay_groups[replay_index + 1]);
+        return;
+    }
+
+    /* Clocks sharing the earliest edge time */
+    fired_clocks.clear();
+    edge_ticks = queue.front().time;
+    Collect(0);
+
+    /* Dependent first, then hybrid and independent */
+    auto is_dependent = [](Clock* clock)
+    {
+        return clock->GetType() == Clock::DEPENDENT;
+    };
+
+    auto is_hybrid = [](Clock* clock)
+    {
+        return clock->GetType() == Clock::HYBRID;
+    };
+
+    next_clocks.assign(fired_clocks.begin(), fired_clocks.end());
+    auto it = std::partition(next_clocks.begin(), next_clocks.end(), is_dependent);
+    std::partition(it, next_clocks.end(), is_hybrid);
+
+    if (mode == RECORDING)
+    {
+        Record();
+    }
+}
+
+Clock::Ticks Scheduler::PeekNextEdgeTicks() const
+{
+    /* Replay: every clock of the next recorded group has the same edge time */
+    if (mode == REPLAY)
+    {
+        size_t index = (replay_index + 2 < replay_groups.size()) ? replay_index + 1 : 0;
+        return replay_clocks[replay_groups[index]]->next_edge_ticks;
+    }
 
-    next_clocks.clear();
+    return queue.front().time;
+}
+
+void Scheduler::RunMastersParallel()
+{
+    /* Modules of the edge, once each */
+    master_batch.clear();
+
+    for (Clock* clock : next_clocks)
+    {
+        for (Module* module : clock->master_order)
+        {
+            if (module->IsMasterNotDone())
+            {
+                module->SetMasterAsDone();
+                master_batch.push_back(module);
+            }
+        }
+    }
+
+    auto by_level = [](Module* a, Module* b)
+    {
+        return a->GetCombinationalLevel() < b->GetCombinationalLevel();
+    };
+
+    std::stable_sort(master_batch.begin(), master_batch.end(), by_level);
+
+    /* Modules of the same level are independent: one batch per level */
+    for (size_t begin {0}, end {0}; begin < master_batch.size(); begin = end)
+    {
+        size_t level = master_batch[begin]->GetCombinationalLevel();
+
+        end = begin + 1;
+        while (end < master_batch.size() && master_batch[end]->GetCombinationalLevel() == level)
+        {
+            end++;
+        }
+
+        if (end - begin > 1)
+        {
+            thread_pool.Run(master_batch.data() + begin, end - begin);
+        }
+        else
+        {
+            master_batch[begin]->RunClockMaster();
+        }
+    }
+
+    /* Fully combinational modules run again on the next edge */
+    for (Module* module : master_batch)
+    {
+        if (module->IsFullyCombinational())
+        {
+            module->SetMasterAsNotDone();
+        }
+    }
+}
+
+/**
+ * @brief Settles every fully combinational module, before the first edge and
+ * when their settings change between two edges.
+ * 
+ */
+void Scheduler::SettleCombinational()
+{
+    for (Module* module : combinational_modules)
+    {
+        module->RunClockMaster();
+    }
+}
+
+/**
+ * @brief Lists the fully combinational modules that read the registers of each
+ * edge table, directly or through other combinational modules. A signal
+ * belongs to the module whose port points to it directly, and a signal of
+ * several modules is read as changed on every edge. The masters of an edge
+ * run before its registers commit, so their combinational sources that read
+ * these registers are in the list too, the others are not settled again.
+ * 
+ * @param clocks 
+ */
+void Scheduler::ElaborateSettleLists(const std::vector<Clock*>& clocks)
+{
+    /* Combinational modules first, then the registered ones */
+    std::vector<Module*> modules(combinational_modules);
+
+    for (Clock* clock : clocks)
+    {
+        modules.insert(modules.end(), clock->posedge_table.modules.begin(), clock->posedge_table.modules.end());
+        modules.insert(modules.end(), clock->negedge_table.modules.begin(), clock->negedge_table.modules.end());
+    }
+
+    /* Links of each module and owner of each signal */
+    std::vector<std::vector<PortLink>> links(modules.size());
+    std::unordered_map<const void*, Module*> owners;
+
+    for (size_t i {0}; i < modules.size(); i++)
+    {
+        std::vector<AbstractPort*> port_ptrs;
+        modules[i]->GetPorts(port_ptrs);
+
+        for (AbstractPort* port : port_ptrs)
+        {
+            port->GetLinks(links[i]);
+        }
+
+        for (const PortLink& link : links[i])
+        {
+            if (link.is_linked || link.data == nullptr)
+            {
+                continue;
+            }
+
+            auto [it, inserted] = owners.try_emplace(link.data, modules[i]);
+
+            if (it->second != modules[i])
+            {
+                it->second = nullptr;
+            }
+        }
+    }
+
+    /* Modules read by each combinational module, nullptr for shared signals */
+    std::vector<std::vector<Module*>> sources(combinational_modules.size());
+
+    for (size_t i {0}; i < combinational_modules.size(); i++)
+    {
+        for (const PortLink& link : links[i])
+        {
+            auto owner = owners.find(link.data);
+
+            if (link.is_linked && owner != owners.end())
+            {
+                sources[i].push_back(owner->second);
+            }
+        }
+    }
+
+    /* Level order: the sources of a module are visited before it */
+    auto elaborate = [&](Clock::EdgeTable& table)
+    {
+        std::unordered_set<Module*> changed(table.modules.begin(), table.modules.end());
+        table.settle.clear();
+
+        for (size_t i {0}; i < combinational_modules.size(); i++)
+        {
+            for (Module* source : sources[i])
+            {
+                if (source == nullptr || changed.count(source))
+                {
+                    table.settle.push_back(combinational_modules[i]);
+                    changed.insert(combinational_modules[i]);
+                    break;
+                }
+            }
+        }
+    };
 
     for (Clock* clock : clocks)
     {
-        /* Skip */
-        if(clock->GetNextEdgeTime() > next_edge_time)
+        elaborate(clock->posedge_table);
+        elaborate(clock->negedge_table);
+    }
+}
+
+void Scheduler::Collect(size_t index)
+{
+    /* Skip: the whole subtree is later than the current edge */
+    if (index >= queue.size() || queue[index].time > edge_ticks)
+    {
+        return;
+    }
+
+    /* Pre-order: parents before children */
+    fired_clocks.push_back(queue[index].clock);
+    Collect(2 * index + 1);
+    Collect(2 * index + 2);
+}
+
+void Scheduler::RekeyDerived(Clock* clock)
+{
+    for (auto &derived : clock->derived_clocks)
+    {
+        Rekey(derived);
+        RekeyDerived(derived);
+    }
+}
+
+bool Scheduler::ComputeHyperPeriod()
+{
+    /* Hyper-period: lcm of the reduced steps num / den is lcm(num) / gcd(den) */
+    Clock::Ticks lcm_num {1};
+    Clock::Ticks gcd_den {0};
+
+    for (auto &event : queue)
+    {
+        Clock::Ticks num, den;
+        event.clock->time.GetStep(num, den);
+
+        Clock::Ticks g = Gcd(num, den);
+        num /= g;
+        den /= g;
+
+        if (__builtin_mul_overflow(lcm_num / Gcd(lcm_num, num), num, &lcm_num))
+        {
+            return false;
+        }
+
+        gcd_den = Gcd(gcd_den, den);
+    }
+
+    /* Smallest integer multiple */
+    hyper_period = lcm_num / Gcd(lcm_num, gcd_den);
+
+    /* Edges per hyper-period */
+    Clock::Ticks n_edges {0};
+
+    for (auto &event : queue)
+    {
+        Clock::Ticks num, den, edges;
+        event.clock->time.GetStep(num, den);
+
+        Clock::Ticks g = Gcd(num, den);
+
+        if (__builtin_mul_overflow(hyper_period / (num / g), den / g, &edges) || (n_edges += edges) > MAX_REPLAY_EDGES)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Scheduler::Record()
+{
+    /* First group of the record */
+    if (replay_groups.empty())
+    {
+        record_start = edge_ticks;
+    }
+
+    Clock::Ticks offset = edge_ticks - record_start;
+
+    replay_groups.push_back(replay_clocks.size());
+    replay_times.push_back(offset);
+    replay_clocks.insert(replay_clocks.end(), next_clocks.begin(), next_clocks.end());
+
+    /* Record two hyper-periods and the first edge of the third */
+    if (offset < 2 * hyper_period)
+    {
+        return;
+    }
+
+    size_t n_groups = static_cast<size_t>(std::lower_bound(replay_times.begin(), replay_times.end(), hyper_period) - replay_times.begin());
+
+    if (IsPeriodic(n_groups))
+    {
+        /* Keep the first hyper-period: the current edge is its first group */
+        replay_clocks.resize(replay_groups[n_groups]);
+        replay_clocks.shrink_to_fit();
+        replay_groups.resize(n_groups + 1);
+        replay_groups.shrink_to_fit();
+        replay_times.clear();
+        replay_times.shrink_to_fit();
+
+        replay_index = 0;
+        mode = REPLAY;
+        return;
+    }
+
+    /* Start-up transient: record again from the current edge */
+    ClearRecord();
+
+    if (++replay_attempts < MAX_REPLAY_ATTEMPTS)
+    {
+        Record();
+    }
+    else
+    {
+        mode = DYNAMIC;
+    }
+}
+
+bool Scheduler::IsPeriodic(size_t n_groups) const
+{
+    if (n_groups == 0 || replay_groups.size() != 2 * n_groups + 1)
+    {
+        return false;
+    }
+
+    auto group_end = [this](size_t group)
+    {
+        return (group + 1 < replay_groups.size()) ? replay_groups[group + 1] : replay_clocks.size();
+    };
+
+    /* Group i + n_groups repeats group i one hyper-period later */
+    for (size_t i = 0; i <= n_groups; i++)
+    {
+        size_t j = i + n_groups;
+
+        if (replay_times[j] != replay_times[i] + hyper_period)
+        {
+            return false;
+        }
+
+        const Clock* const* begin_i = replay_clocks.data() + replay_groups[i];
+        const Clock* const* end_i = replay_clocks.data() + group_end(i);
+        const Clock* const* begin_j = replay_clocks.data() + replay_groups[j];
+        const Clock* const* end_j = replay_clocks.data() + group_end(j);
+
+        if (!std::is_permutation(begin_i, end_i, begin_j, end_j))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Scheduler::ClearRecord()
+{
+    replay_clocks.clear();
+    replay_groups.clear();
+    replay_times.clear();
+}
+
+void Scheduler::Fallback()
+{
+    mode = DYNAMIC;
+    ClearRecord();
+    replay_clocks.shrink_to_fit();
+    replay_groups.shrink_to_fit();
+    replay_times.shrink_to_fit();
+
+    /* Rebuild the heap with the current edge times */
+    for (auto &event : queue)
+    {
+        event.time = event.clock->next_edge_ticks;
+    }
+
+    for (size_t index = queue.size() / 2; index-- > 0;)
+    {
+        SiftDown(index);
+    }
+}
+
+Clock::Ticks Scheduler::Gcd(Clock::Ticks a, Clock::Ticks b)
+{
+    while (b != 0)
+    {
+        Clock::Ticks r = a % b;
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+void Scheduler::Push(Clock* clock)
+{
+    clock->scheduler_index = queue.size();
+    queue.push_back({clock->next_edge_ticks, clock});
+    SiftUp(clock->scheduler_index);
+}
+
+void Scheduler::Rekey(Clock* clock)
+{
+    Event &event = queue[clock->scheduler_index];
+
+    /* Skip: same edge time */
+    if (event.time == clock->next_edge_ticks)
+    {
+        return;
+    }
+
+    event.time = clock->next_edge_ticks;
+    SiftUp(clock->scheduler_index);
+    SiftDown(clock->scheduler_index);
+}
+
+void Scheduler::SiftUp(size_t index)
+{
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+
+        if (queue[index].time >= queue[parent].time)
         {
             break;
         }
 
-        /* Add to NextClocks */
-        switch (clock->GetType())
+        Swap(index, parent);
+        index = parent;
+    }
+}
+
+void Scheduler::SiftDown(size_t index)
+{
+    while (true)
+    {
+        size_t smallest = index;
+        size_t left = 2 * index + 1;
+        size_t right = 2 * index + 2;
+
+        if (left < queue.size() && queue[left].time < queue[smallest].time)
+        {
+            smallest = left;
+        }
+
+        if (right < queue.size() && queue[right].time < queue[smallest].time)
         {
-            /* Independent */
-            case 'i':
-                next_clocks.push_back(clock);
-                break;
-            
-            /* Dependent */
-            case 'd':
-                next_clocks.push_front(clock);
-                front_count ++;
-                break;
+            smallest = right;
+        }
 
-            /* Hybrid */
-            case 'h':
-                next_clocks.insert(next_clocks.begin() + front_count, clock);
-                break;
+        if (smallest == index)
+        {
+            break;
         }
+
+        Swap(index, smallest);
+        index = smallest;
     }
-}
\ No newline at end of file
+}
+
+void Scheduler::Swap(size_t index_a, size_t index_b)
+{
+    std::swap(queue[index_a], queue[index_b]);
+    queue[index_a].clock->scheduler_index = index_a;
+    queue[index_b].clock->scheduler_index = index_b;
+}
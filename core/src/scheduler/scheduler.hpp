@@ -0,0 +1,139 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 07/02/2024
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "clock.hpp"
+#include "thread_pool.hpp"
+
+/*******************************************************************************
+* SCHEDULER CLASS
+********************************************************************************/
+
+class Scheduler
+{
+private:
+
+    /* Event queue entry: edge time cached as the heap key */
+    struct Event
+    {
+        Clock::Ticks time;
+        Clock* clock;
+    };
+
+    /* Event queue: binary min-heap keyed on the next edge time */
+    std::vector<Event> queue;
+    Clock::Ticks edge_ticks { 0 };
+
+    /* Clocks of the current edge, parents before children in the heap */
+    std::vector<Clock*> fired_clocks;
+
+    /* Fully combinational modules, and those settled after the current edge */
+    std::vector<Module*> combinational_modules;
+    std::vector<Module*> settle_batch;
+
+    /* Parallel masters: modules of the current edge in level order */
+    ThreadPool thread_pool;
+    std::vector<Module*> master_batch;
+
+    /* Event queue */
+    void Push(Clock* clock);
+    void Rekey(Clock* clock);
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+    void Swap(size_t index_a, size_t index_b);
+
+    /* Clocks with the earliest edge time */
+    void Collect(size_t index);
+
+    /* Fully combinational modules downstream of each edge table */
+    void ElaborateSettleLists(const std::vector<Clock*>& clocks);
+
+    /* Masters of the current edge on the thread pool */
+    void RunMastersParallel();
+
+    /* Derived clocks resynchronized by an edge */
+    void RekeyDerived(Clock* clock);
+
+    /* Hyper-period replay */
+    enum Mode{DYNAMIC, RECORDING, REPLAY};
+
+    static constexpr size_t MAX_REPLAY_EDGES { 1 << 16 };
+    static constexpr unsigned int MAX_REPLAY_ATTEMPTS { 4 };
+
+    Mode mode { DYNAMIC };
+    bool period_changed { false };
+    unsigned int replay_attempts { 0 };
+    Clock::Ticks hyper_period { 0 };
+    Clock::Ticks record_start { 0 };
+
+    /* Flat schedule: group i is replay_clocks[replay_groups[i] .. replay_groups[i + 1]) */
+    std::vector<Clock*> replay_clocks;
+    std::vector<size_t> replay_groups;
+    std::vector<Clock::Ticks> replay_times;
+    size_t replay_index { 0 };
+
+    bool ComputeHyperPeriod();
+    void Record();
+    bool IsPeriodic(size_t n_groups) const;
+    void ClearRecord();
+    void Fallback();
+
+    static Clock::Ticks Gcd(Clock::Ticks a, Clock::Ticks b);
+
+public:
+
+    void Init(const std::vector<Clock*>& clocks, bool replay, size_t n_threads, const std::vector<Module*>& combinational_order);
+    void RunClocks();
+    void UpdateNextClocks();
+    Clock::Ticks PeekNextEdgeTicks() const;
+    void SettleCombinational();
+
+    std::vector<Clock*> next_clocks;
+};
@@ -0,0 +1,214 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "stimulus_file.hpp"
+
+/*******************************************************************************
+* STIMULUS FILE CLASS
+********************************************************************************/
+
+StimulusFile::~StimulusFile()
+{
+    if (samples != nullptr)
+    {
+        munmap(const_cast<char*>(samples), file_bytes);
+    }
+
+    if (file_descriptor >= 0)
+    {
+        close(file_descriptor);
+    }
+}
+
+/**
+ * @brief Map the file, which must hold a whole number of samples
+ * 
+ * @param name 
+ * @param bytes_per_sample 
+ * @param loop Start again after the last sample
+ */
+void StimulusFile::Open(const std::string& name, size_t bytes_per_sample, bool loop)
+{
+    file_name = name;
+    sample_bytes = bytes_per_sample;
+    is_loop = loop;
+
+    file_descriptor = open(file_name.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + file_name + ": " + std::strerror(errno);
+        throw std::runtime_error(error_text);
+    }
+
+    struct stat file_stat;
+    if (fstat(file_descriptor, &file_stat) != 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + file_name + ": " + std::strerror(errno);
+        throw std::runtime_error(error_text);
+    }
+
+    file_bytes = static_cast<size_t>(file_stat.st_size);
+    n_samples = file_bytes / sample_bytes;
+
+    if (n_samples == 0 || file_bytes % sample_bytes != 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid stimulus file]: "
+                               + file_name + " has " + std::to_string(file_bytes)
+                               + " bytes, it must hold a whole number of samples of "
+                               + std::to_string(sample_bytes) + " bytes.";
+        throw std::runtime_error(error_text);
+    }
+
+    void* memory = mmap(nullptr, file_bytes, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (memory == MAP_FAILED)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be mapped]: "
+                               + file_name + ": " + std::strerror(errno);
+        throw std::runtime_error(error_text);
+    }
+
+    samples = static_cast<const char*>(memory);
+    madvise(memory, file_bytes, MADV_SEQUENTIAL);
+
+    index = 0;
+    read_ahead_index = 0;
+    ReadAhead();
+}
+
+/**
+ * @brief Next sample of the file
+ * 
+ * @return const void* nullptr after the last sample, unless it loops
+ */
+const void* StimulusFile::Next()
+{
+    if (index == n_samples)
+    {
+        if (!is_loop)
+        {
+            return nullptr;
+        }
+
+        index = 0;
+        read_ahead_index = 0;
+        ReadAhead();
+    }
+
+    const char* sample = samples + index * sample_bytes;
+    index++;
+
+    if (index * sample_bytes >= read_ahead_index)
+    {
+        ReadAhead();
+    }
+    return sample;
+}
+
+size_t StimulusFile::GetSampleCount() const
+{
+    return n_samples;
+}
+
+/**
+ * @brief Samples already read
+ * 
+ * @return size_t 
+ */
+size_t StimulusFile::GetIndex() const
+{
+    return index;
+}
+
+/**
+ * @brief Continue from a sample, e.g. of a restored checkpoint
+ * 
+ * @param sample 
+ */
+void StimulusFile::Seek(size_t sample)
+{
+    index = std::min(sample, n_samples);
+    ReadAhead();
+}
+
+/**
+ * @brief Asks the kernel for the pages that follow the current sample, so
+ * the simulation does not wait for the disk
+ * 
+ */
+void StimulusFile::ReadAhead()
+{
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t first = (index * sample_bytes) / page_size * page_size;
+    size_t last = std::min(first + READ_AHEAD_BYTES, file_bytes);
+
+    if (first < last)
+    {
+        madvise(const_cast<char*>(samples) + first, last - first, MADV_WILLNEED);
+    }
+
+    /* Next request once half of these bytes are read */
+    read_ahead_index = first + READ_AHEAD_BYTES / 2;
+}
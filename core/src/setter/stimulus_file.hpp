@@ -0,0 +1,90 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <string>
+
+/*******************************************************************************
+* STIMULUS FILE CLASS
+********************************************************************************/
+
+/**
+ * @brief Binary file of samples read one by one through a memory map, e.g. a
+ * binary LOG of another run. The whole file is mapped for sequential access
+ * and the pages ahead of the current sample are requested in advance.
+ */
+class StimulusFile
+{
+private:
+
+    int file_descriptor { -1 };
+    const char* samples { nullptr };
+    size_t file_bytes { 0 };
+    size_t sample_bytes { 0 };
+    size_t n_samples { 0 };
+    size_t index { 0 };
+    size_t read_ahead_index { 0 };
+    bool is_loop { false };
+    std::string file_name;
+
+    void ReadAhead();
+
+public:
+
+    /* Bytes requested in advance, each time half of them were read */
+    static constexpr size_t READ_AHEAD_BYTES { 1UL << 22 };
+
+    StimulusFile() = default;
+    StimulusFile(const StimulusFile&) = delete;
+    StimulusFile& operator=(const StimulusFile&) = delete;
+    ~StimulusFile();
+
+    void Open(const std::string& name, size_t bytes_per_sample, bool loop);
+    const void* Next();
+    size_t GetSampleCount() const;
+
+    /* Position, e.g. for checkpoints */
+    size_t GetIndex() const;
+    void Seek(size_t sample);
+};
@@ -40,12 +40,18 @@
 * STANDARD HEADERS
 ********************************************************************************/
 
+#include <algorithm>
 #include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <thread>
 
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
 
+#include "checkpoint.hpp"
 #include "simulator.hpp"
 
 /*******************************************************************************
@@ -61,6 +67,13 @@ void Simulator::ProcessOptions(int argc, char *argv[])
     app.add_option("-x,--hierarchy_file", hierarchy_file)->default_str(hierarchy_file);
     app.add_option("-c,--commands_file", command_file)->default_str(command_file);
     app.add_option("-l,--logger_dir", logger_dir)->default_str(logger_dir);
+    app.add_option("--sweep", sweep_file);
+    app.add_option("--sweep_dir", sweep_dir)->default_str(sweep_dir);
+    app.add_option("-j,--jobs", sweep_jobs)->default_str("all cores");
+    app.add_option("--warmup", sweep_warmup);
+    app.add_option("--checkpoint_every", checkpoint_every);
+    app.add_option("--checkpoint_out", checkpoint_file)->default_str(checkpoint_file);
+    app.add_option("--restore", restore_file);
     
     /* Flags */
     app.add_flag("-e,--export_files", export_files)->default_val(export_files);
@@ -88,6 +101,20 @@ void Simulator::ProcessOptions(int argc, char *argv[])
         ExportHierarchyFile(hierarchy_file);
         std::exit(0);
     }
+
+    /* Parameter sweep: only the process of each case returns */
+    if (!sweep_file.empty())
+    {
+        CoreSweep();
+    }
+    else if (sweep_warmup)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [warmup without sweep]: "
+                               + "--warmup needs a --sweep file";
+        throw std::runtime_error(error_text);
+    }
 }
 
 void Simulator::Run()
@@ -110,40 +137,89 @@ void Simulator::Run()
     tic_toc.Tic("__loop__");
 
     /* Main loop */
-    do
+    if (domain_scheduler.GetDomainCount())
     {
-        scheduler.UpdateNextClocks();
-        cmd_handler.Run(scheduler.next_clocks);
-        
-        if(cmd_handler.sets.size())
+        /* Clock domains: user methods at each reference clock edge */
+        do
         {
-            setter.Run(cmd_handler.sets);
-        }
-        
-        scheduler.RunClocks();
-        
-        if(cmd_handler.logs.size())
+            domain_scheduler.RunWindow();
+            logger.Sync();
+            Iteration();
+            iteration_counter++;
+        } while (ContinueRunning());
+    }
+    else
+    {
+        do
         {
-            logger.Run(cmd_handler.logs);
-        }
-        
-        Iteration();
-        iteration_counter++;
-    } while (ContinueRunning());
+            /* Checkpoint between two iterations */
+            if (checkpoint_every && cmd_handler.tick >= next_checkpoint)
+            {
+                CoreSaveCheckpoint();
+            }
+
+            scheduler.UpdateNextClocks();
+            cmd_handler.Run(scheduler.next_clocks);
+
+            /* End of the warm-up: the cases continue from here */
+            if (sweep_warmup && cmd_handler.tick >= sweep_warmup)
+            {
+                CoreFork();
+            }
+            
+            if(cmd_handler.sets.size())
+            {
+                setter.Run(cmd_handler.sets);
+                scheduler.SettleCombinational();
+            }
+            
+            scheduler.RunClocks();
+            
+            if(cmd_handler.logs.size())
+            {
+                logger.Run(cmd_handler.logs);
+                logger.Sync();
+            }
+
+            if(cmd_handler.stats.size())
+            {
+                logger.Run(cmd_handler.stats);
+            }
+
+            if(cmd_handler.captures.size())
+            {
+                logger.Run(cmd_handler.captures, cmd_handler.tick);
+            }
+            
+            Iteration();
+            iteration_counter++;
+        } while (ContinueRunning());
+    }
+
+    /* The run ended before the warm-up: no case ran */
+    if (sweep_warmup)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid warmup]: "
+                               + "the simulation ended at tick " + std::to_string(cmd_handler.tick)
+                               + ", before the end of the warm-up at tick " + std::to_string(sweep_warmup);
+        throw std::runtime_error(error_text);
+    }
 
     /* Loop Time */
     auto loop_time = tic_toc.Toc("__loop__");
 
     /* End process */
     cmd_handler.Terminate();
-    logger.Terminate(cmd_handler.logs, cmd_handler.flogs);
+    logger.Terminate(cmd_handler.logs, cmd_handler.flogs, cmd_handler.stats, cmd_handler.captures);
     Terminate();
 
     /* All Time */
     auto run_time = tic_toc.Toc("__begin_end__");
 
     /* Time report */
-    std::ofstream ofile_handler("time.txt");
+    std::ofstream ofile_handler(time_file);
     ofile_handler << run_time << ',' << loop_time << std::endl;
     ofile_handler.close();
 }
@@ -156,6 +232,9 @@ void Simulator::CoreReflect()
 {
     /* YAML variables */
     REFLECT_YAML(logger_buffer_size);
+    REFLECT_YAML(scheduler_replay);
+    REFLECT_YAML(scheduler_threads);
+    REFLECT_YAML(scheduler_domains);
     
     /* Clocks */
     REFLECT(clk_cmd_handler);
@@ -177,8 +256,352 @@ void Simulator::CoreConnect()
 void Simulator::CoreInit()
 {
     cmd_handler.Init(command_file, GetMapPointers());
-    logger.Init(logger_dir, logger_buffer_size);
-    scheduler.Init();
+
+    /* With a warm-up, each case starts its logger after the fork */
+    if (sweep_warmup)
+    {
+        CoreCheckWarmup();
+    }
+    else
+    {
+        logger.Init(logger_dir, logger_buffer_size, cmd_handler.GetLogCommands());
+    }
+
+    /* Checkpoints hold the state of the serial loop */
+    if (checkpoint_every || !restore_file.empty())
+    {
+        if (scheduler_domains)
+        {
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [invalid checkpoint]: "
+                                   + "checkpoints need scheduler_domains = 0";
+            throw std::runtime_error(error_text);
+        }
+
+        if (!restore_file.empty())
+        {
+            CoreRestoreCheckpoint();
+        }
+
+        next_checkpoint = clk_cmd_handler.GetTickCount() + checkpoint_every;
+    }
+
+    /* Clock domains on their own threads, if there are several */
+    if (scheduler_domains)
+    {
+        domain_scheduler.Init(*this, clk_cmd_handler, clock_context.GetClocks(), cmd_handler, setter, logger,
+                              scheduler_replay, scheduler_threads, GetCombinationalOrder());
+    }
+
+    if (!domain_scheduler.GetDomainCount())
+    {
+        scheduler.Init(clock_context.GetClocks(), scheduler_replay, scheduler_threads, GetCombinationalOrder());
+    }
+}
+
+/**
+ * @brief Runs the cases of the sweep file, each in a copy of this process.
+ * The copies continue with the settings and the outputs of their case
+ * directory, and the calling process exits once every case ended.
+ * 
+ */
+void Simulator::CoreSweep()
+{
+    /* Each case logs in its own directory */
+    if (std::filesystem::path(logger_dir).is_absolute())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid logger dir]: "
+                               + logger_dir + ", a sweep needs a logger dir relative to the case directories";
+        throw std::runtime_error(error_text);
+    }
+
+    size_t jobs = sweep_jobs ? sweep_jobs : std::max(1u, std::thread::hardware_concurrency());
+    sweep = std::make_unique<SweepRunner>(sweep_file, settings_file, sweep_dir, jobs);
+
+    /* With a warm-up the cases start from Run() */
+    if (sweep_warmup)
+    {
+        return;
+    }
+
+    if (!sweep->Run())
+    {
+        std::exit(sweep->GetFailedCount() ? 1 : 0);
+    }
+
+    settings_file = sweep->GetDirectory() + "/settings.yaml";
+    CoreCaseOutputs();
+}
+
+/**
+ * @brief The outputs of a case go to its directory: the logs, time.txt and
+ * the checkpoints. The inputs keep the paths of the calling process.
+ * 
+ */
+void Simulator::CoreCaseOutputs()
+{
+    std::filesystem::path directory = sweep->GetDirectory();
+
+    logger_dir = (directory / logger_dir).lexically_normal().string();
+    time_file = (directory / time_file).string();
+    checkpoint_file = (directory / checkpoint_file).lexically_normal().string();
+}
+
+/**
+ * @brief The warm-up runs in a single thread, since the cases are copies of
+ * it, and logs nothing: the logs, statistics and captures of the cases must
+ * begin after it.
+ * 
+ */
+void Simulator::CoreCheckWarmup()
+{
+    if (scheduler_domains || scheduler_threads > 1)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid warmup]: "
+                               + "the warm-up needs scheduler_domains = 0 and scheduler_threads = 1";
+        throw std::runtime_error(error_text);
+    }
+
+    auto check = [&](const auto& commands)
+    {
+        for (const auto& command : commands)
+        {
+            if (command.begin < sweep_warmup)
+            {
+                std::string error_text = std::string(__FILE__) + ":"
+                                       + std::to_string(__LINE__) + ": "
+                                       + "ERROR [invalid warmup]: "
+                                       + command.signal + " begins at tick " + std::to_string(command.begin)
+                                       + ", before the end of the warm-up at tick " + std::to_string(sweep_warmup);
+                throw std::runtime_error(error_text);
+            }
+        }
+    };
+
+    check(cmd_handler.GetLogCommands());
+    check(cmd_handler.GetStatCommands());
+    check(cmd_handler.GetCaptureCommands());
+}
+
+/**
+ * @brief Starts the cases from the warmed-up state. Each case sets its values
+ * through the handlers, lets the modules that own them reconfigure, and
+ * starts its logger in its directory. A setting of a module without
+ * Reconfigure() is an error.
+ * 
+ */
+void Simulator::CoreFork()
+{
+    if (!sweep->Run())
+    {
+        std::exit(sweep->GetFailedCount() ? 1 : 0);
+    }
+
+    HandlersMap handlers = GetMapPointers();
+    std::map<std::string, std::string> owners;
+
+    for (const auto& [key, value] : sweep->GetOverrides())
+    {
+        auto it = handlers.find(key);
+        if (it == handlers.end())
+        {
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [unknown reference]: "
+                                   + key;
+            throw std::runtime_error(error_text);
+        }
+
+        it->second->SetFromString(value);
+        owners.emplace(key.substr(0, key.rfind('.')), key);
+    }
+
+    std::vector<Module*> modules;
+    GetModules(modules);
+
+    for (Module* module : modules)
+    {
+        auto owner = owners.find(module->GetFullName());
+        if (owner != owners.end() && module->Reconfigure())
+        {
+            owners.erase(owner);
+        }
+    }
+
+    /* Otherwise the module would keep what it derived from the old value */
+    if (!owners.empty())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [setting not reconfigurable]: "
+                               + owners.begin()->second + ", " + owners.begin()->first
+                               + " does not implement Reconfigure()";
+        throw std::runtime_error(error_text);
+    }
+
+    /* Combinational outputs on the settings of the case */
+    scheduler.SettleCombinational();
+
+    sweep_warmup = 0;
+    CoreCaseOutputs();
+    logger.Init(logger_dir, logger_buffer_size, cmd_handler.GetLogCommands());
+}
+
+/**
+ * @brief Saves the state between two iterations: the reflected variables
+ * and registers, and the state of the registers, clocks, modules and SET
+ * commands that is not reflected. Ports and clocks are not saved as values,
+ * they point to variables.
+ * 
+ */
+void Simulator::CoreSaveCheckpoint()
+{
+    Checkpoint checkpoint;
+
+    auto save = [&](const std::string& key, const std::string& type, const auto& object)
+    {
+        std::ostringstream stream;
+        object.SaveState(stream);
+        checkpoint.Add(key, type, stream.str());
+    };
+
+    /* Variables and registers */
+    std::map<std::string, std::string> types = GetMapTypes();
+
+    for (const auto& [key, handler] : GetMapPointers())
+    {
+        auto it = types.find(key);
+        if (it == types.end() || it->second.front() != '*')
+        {
+            continue;
+        }
+
+        std::string data(handler->GetValueBytes(), '\0');
+        handler->GetValue(data.data());
+        checkpoint.Add(key, handler->GetTypeAsString(), std::move(data));
+    }
+
+    /* State that is not reflected */
+    std::vector<Module*> modules;
+    GetModules(modules);
+
+    for (Module* module : modules)
+    {
+        /* Masters already run on this edge, then the state of the module */
+        std::ostringstream stream;
+        Checkpoint::Write(stream, module->IsMasterDone());
+        module->SaveState(stream);
+        checkpoint.Add(module->GetFullName(), "module", stream.str());
+
+        std::vector<AbstractRegister*> registers;
+        module->GetRegisters(registers);
+
+        for (AbstractRegister* reg : registers)
+        {
+            save(reg->GetFullName(), "register", *reg);
+        }
+    }
+
+    for (Clock* clock : clock_context.GetClocks())
+    {
+        save(clock->GetFullName(), "clock", *clock);
+    }
+
+    const std::vector<SetCommand>& set_list = cmd_handler.GetSetCommands();
+    for (size_t i = 0; i < set_list.size(); i++)
+    {
+        save("SET " + std::to_string(i), "command", set_list[i]);
+    }
+
+    std::ostringstream stream;
+    Checkpoint::Write(stream, iteration_counter);
+    checkpoint.Add("__iteration_counter__", "unsigned long", stream.str());
+
+    checkpoint.Save(checkpoint_file);
+    next_checkpoint = cmd_handler.tick + checkpoint_every;
+}
+
+/**
+ * @brief Loads a checkpoint of the same model after Init(). The loop then
+ * continues from the iteration after it, with a new logger.
+ * 
+ */
+void Simulator::CoreRestoreCheckpoint()
+{
+    Checkpoint checkpoint;
+    checkpoint.Load(restore_file);
+
+    auto restore = [&](const std::string& key, const std::string& type, auto& object)
+    {
+        std::istringstream stream(checkpoint.Get(key, type));
+        object.RestoreState(stream);
+    };
+
+    /* Variables and registers */
+    std::map<std::string, std::string> types = GetMapTypes();
+
+    for (const auto& [key, handler] : GetMapPointers())
+    {
+        auto it = types.find(key);
+        if (it == types.end() || it->second.front() != '*')
+        {
+            continue;
+        }
+
+        handler->SetValue(checkpoint.Get(key, handler->GetTypeAsString(), handler->GetValueBytes()).data());
+    }
+
+    /* State that is not reflected */
+    std::vector<Module*> modules;
+    GetModules(modules);
+
+    for (Module* module : modules)
+    {
+        std::istringstream stream(checkpoint.Get(module->GetFullName(), "module"));
+        bool is_master_done;
+        Checkpoint::Read(stream, is_master_done);
+        module->RestoreState(stream);
+
+        if (is_master_done)
+        {
+            module->SetMasterAsDone();
+        }
+        else
+        {
+            module->SetMasterAsNotDone();
+        }
+
+        std::vector<AbstractRegister*> registers;
+        module->GetRegisters(registers);
+
+        for (AbstractRegister* reg : registers)
+        {
+            restore(reg->GetFullName(), "register", *reg);
+        }
+    }
+
+    for (Clock* clock : clock_context.GetClocks())
+    {
+        restore(clock->GetFullName(), "clock", *clock);
+    }
+
+    std::vector<SetCommand>& set_list = cmd_handler.GetSetCommands();
+    for (size_t i = 0; i < set_list.size(); i++)
+    {
+        restore("SET " + std::to_string(i), "command", set_list[i]);
+    }
+
+    std::istringstream stream(checkpoint.Get("__iteration_counter__", "unsigned long"));
+    Checkpoint::Read(stream, iteration_counter);
+
+    checkpoint.CheckRestored();
+
+    std::cout << "-- Restored " << restore_file << " at tick " << clk_cmd_handler.GetTickCount() << std::endl;
 }
 
 /**
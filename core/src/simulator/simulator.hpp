@@ -43,17 +43,21 @@
 ********************************************************************************/
 
 #include <iostream>
+#include <memory>
 
 /*******************************************************************************
 * LOCAL HEADERS
 ********************************************************************************/
 
 #include "CLI11.hpp"
+#include "clock_context.hpp"
 #include "command_handler.hpp"
+#include "domain_scheduler.hpp"
 #include "logger.hpp"
 #include "module.hpp"
 #include "scheduler.hpp"
 #include "setter.hpp"
+#include "sweep_runner.hpp"
 #include "tictoc.hpp"
 
 /*******************************************************************************
@@ -84,18 +88,41 @@ private:
     void CoreReflect();
     void CoreConnect();
     void CoreCheck();
+    void CoreSweep();
+    void CoreCheckWarmup();
+    void CoreFork();
+    void CoreCaseOutputs();
+    void CoreSaveCheckpoint();
+    void CoreRestoreCheckpoint();
     
     /* Default vars */
     std::string command_file { "../conf/command.cmd" };
     std::string settings_file { "../conf/settings.yaml" };
     std::string hierarchy_file { "../conf/hierarchy.txt" };
     std::string logger_dir { "./logs/" };
+    std::string time_file { "time.txt" };
     bool export_files { false };
+    std::string sweep_file { "" };
+    std::string sweep_dir { "./sweep/" };
+    unsigned long sweep_jobs { 0 };
+    unsigned long long sweep_warmup { 0 };
+    std::unique_ptr<SweepRunner> sweep;
+    std::string checkpoint_file { "./checkpoint.bin" };
+    std::string restore_file { "" };
+    unsigned long long checkpoint_every { 0 };
+    unsigned long long next_checkpoint { 0 };
     unsigned long iteration_counter { 0 };
     unsigned long logger_buffer_size { 1000 };
+    bool scheduler_replay { true };
+    unsigned long scheduler_threads { 1 };
+    bool scheduler_domains { false };
+
+    /* Clocks of this simulator: built first, so every clock registers in it */
+    ClockContext clock_context;
 
     /* Private modules */
     Scheduler scheduler;
+    DomainScheduler domain_scheduler;
     CommandHandler cmd_handler;
     Logger logger;
     Setter setter;
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+/*******************************************************************************
+* SPSC QUEUE CLASS
+********************************************************************************/
+
+/**
+ * @brief Bounded lock-free queue for one producer thread and one consumer
+ * thread. The capacity is rounded up to a power of two. Each side keeps a
+ * cached copy of the other side's index, so the shared indexes are only
+ * read when the queue looks full or empty.
+ */
+template<typename T>
+class SpscQueue
+{
+private:
+
+    static constexpr size_t CACHE_LINE { 64 };
+
+    std::vector<T> buffer;
+    size_t mask { 0 };
+
+    /* Consumer side */
+    alignas(CACHE_LINE) std::atomic<size_t> head { 0 };
+    size_t cached_tail { 0 };
+
+    /* Producer side */
+    alignas(CACHE_LINE) std::atomic<size_t> tail { 0 };
+    size_t cached_head { 0 };
+
+public:
+
+    explicit SpscQueue(size_t capacity);
+
+    /* Producer */
+    bool Push(const T& value);
+
+    /* Consumer */
+    T* Front();
+    void Pop();
+
+    size_t GetCapacity() const;
+};
+
+template<typename T>
+SpscQueue<T>::SpscQueue(size_t capacity)
+    : buffer(std::bit_ceil(capacity < 2 ? size_t {2} : capacity)),
+      mask(buffer.size() - 1)
+{
+}
+
+/**
+ * @brief Push a copy of value. Returns false if the queue is full.
+ * 
+ * @param value 
+ */
+template<typename T>
+bool SpscQueue<T>::Push(const T& value)
+{
+    size_t index = tail.load(std::memory_order_relaxed);
+
+    if (index - cached_head == buffer.size())
+    {
+        cached_head = head.load(std::memory_order_acquire);
+
+        if (index - cached_head == buffer.size())
+        {
+            return false;
+        }
+    }
+
+    buffer[index & mask] = value;
+    tail.store(index + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Oldest element, or nullptr if the queue is empty.
+ * 
+ */
+template<typename T>
+T* SpscQueue<T>::Front()
+{
+    size_t index = head.load(std::memory_order_relaxed);
+
+    if (index == cached_tail)
+    {
+        cached_tail = tail.load(std::memory_order_acquire);
+
+        if (index == cached_tail)
+        {
+            return nullptr;
+        }
+    }
+
+    return &buffer[index & mask];
+}
+
+/**
+ * @brief Release the element returned by Front().
+ * 
+ */
+template<typename T>
+void SpscQueue<T>::Pop()
+{
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+template<typename T>
+size_t SpscQueue<T>::GetCapacity() const
+{
+    return buffer.size();
+}
@@ -0,0 +1,568 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "sweep_runner.hpp"
+
+/*******************************************************************************
+* SWEEP RUNNER CLASS
+********************************************************************************/
+
+/**
+ * @brief Loads the sweep and writes the settings of every case.
+ * 
+ * @param sweep_file Axes of the sweep
+ * @param settings_file Settings shared by all the cases
+ * @param sweep_dir Directory of the cases and the summary
+ * @param jobs Cases that run at the same time
+ */
+SweepRunner::SweepRunner(const std::string& sweep_file, const std::string& settings_file,
+                         const std::string& sweep_dir, size_t jobs)
+    : output_dir(std::filesystem::absolute(sweep_dir).lexically_normal()), n_jobs(std::max<size_t>(jobs, 1))
+{
+    std::ifstream file_handler(settings_file);
+    if (!file_handler.is_open())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + settings_file;
+        throw std::runtime_error(error_text);
+    }
+    file_handler.close();
+
+    YAML::Node settings = YAML::LoadFile(settings_file);
+    LoadAxes(sweep_file, settings);
+    CreateCases(settings);
+}
+
+/**
+ * @brief Each key is a setting of the settings file and its value a value, a
+ * range or a list of both.
+ * 
+ * @param sweep_file 
+ * @param settings 
+ */
+void SweepRunner::LoadAxes(const std::string& sweep_file, const YAML::Node& settings)
+{
+    std::ifstream file_handler(sweep_file);
+    if (!file_handler.is_open())
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [file could not be opened]: "
+                               + sweep_file;
+        throw std::runtime_error(error_text);
+    }
+    file_handler.close();
+
+    YAML::Node sweep = YAML::LoadFile(sweep_file);
+    if (!sweep.IsMap() || sweep.size() == 0)
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid sweep file]: "
+                               + sweep_file + ": expected a map of settings and values";
+        throw std::runtime_error(error_text);
+    }
+
+    for (const auto& item : sweep)
+    {
+        Axis axis;
+        axis.key = item.first.as<std::string>();
+
+        std::stringstream key_stream(axis.key);
+        for (std::string level; std::getline(key_stream, level, '.');)
+        {
+            axis.path.push_back(level);
+        }
+
+        if (axis.path.empty() || !HasSetting(settings, axis.path, 0))
+        {
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [unknown setting]: "
+                                   + axis.key;
+            throw std::runtime_error(error_text);
+        }
+
+        axis.values = ParseValues(axis.key, item.second);
+        axes.push_back(std::move(axis));
+    }
+}
+
+std::vector<YAML::Node> SweepRunner::ParseValues(const std::string& key, const YAML::Node& node)
+{
+    std::vector<YAML::Node> values;
+    std::vector<YAML::Node> items;
+
+    if (node.IsSequence())
+    {
+        for (const auto& item : node)
+        {
+            items.push_back(item);
+        }
+    }
+    else
+    {
+        items.push_back(node);
+    }
+
+    for (const auto& item : items)
+    {
+        if (!item.IsScalar())
+        {
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [invalid sweep values]: "
+                                   + key + ": expected values or ranges";
+            throw std::runtime_error(error_text);
+        }
+
+        if (item.Scalar().find("..") != std::string::npos)
+        {
+            ParseRange(key, item.Scalar(), values);
+        }
+        else
+        {
+            values.push_back(YAML::Clone(item));
+        }
+    }
+
+    return values;
+}
+
+/**
+ * @brief Expands "first..last" or "first..last step size". The last value is
+ * included when the range reaches it. Integer ranges give integer values.
+ * 
+ * @param key Setting of the range
+ * @param range 
+ * @param values Expanded values
+ */
+void SweepRunner::ParseRange(const std::string& key, const std::string& range, std::vector<YAML::Node>& values)
+{
+    size_t dots = range.find("..");
+    size_t step_pos = range.find("step", dots);
+
+    std::string fields[3] = {range.substr(0, dots),
+                             range.substr(dots + 2, (step_pos == std::string::npos) ? std::string::npos : step_pos - dots - 2),
+                             (step_pos == std::string::npos) ? "1" : range.substr(step_pos + 4)};
+    double numbers[3] = {0, 0, 0};
+    bool integer = true;
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        size_t begin = fields[i].find_first_not_of(' ');
+        size_t end = fields[i].find_last_not_of(' ');
+        std::string field = (begin == std::string::npos) ? std::string() : fields[i].substr(begin, end - begin + 1);
+
+        auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), numbers[i]);
+        if (field.empty() || ec != std::errc() || ptr != field.data() + field.size())
+        {
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [invalid sweep range]: "
+                                   + key + ": " + range;
+            throw std::runtime_error(error_text);
+        }
+
+        integer = integer && (field.find_first_of(".eE") == std::string::npos);
+    }
+
+    auto [first, last, step] = numbers;
+    if (!(step > 0))
+    {
+        std::string error_text = std::string(__FILE__) + ":"
+                               + std::to_string(__LINE__) + ": "
+                               + "ERROR [invalid sweep range]: "
+                               + key + ": " + range + ": the step must be positive";
+        throw std::runtime_error(error_text);
+    }
+
+    double direction = (last < first) ? -1.0 : 1.0;
+    size_t count = static_cast<size_t>(std::floor(std::abs(last - first) / step + 1e-9)) + 1;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        double value = first + direction * static_cast<double>(i) * step;
+
+        if (integer)
+        {
+            values.push_back(YAML::Node(std::to_string(std::llround(value))));
+        }
+        else
+        {
+            std::ostringstream text;
+            text.precision(12);
+            text << value;
+            values.push_back(YAML::Node(text.str()));
+        }
+    }
+}
+
+bool SweepRunner::HasSetting(const YAML::Node& settings, const std::vector<std::string>& path, size_t level)
+{
+    if (!settings.IsMap())
+    {
+        return false;
+    }
+
+    const YAML::Node node = settings[path[level]];
+    if (!node)
+    {
+        return false;
+    }
+
+    return (level + 1 == path.size()) || HasSetting(node, path, level + 1);
+}
+
+void SweepRunner::SetSetting(YAML::Node settings, const std::vector<std::string>& path, size_t level,
+                             const YAML::Node& value)
+{
+    if (level + 1 == path.size())
+    {
+        settings[path[level]] = value;
+        return;
+    }
+
+    SetSetting(settings[path[level]], path, level + 1, value);
+}
+
+/**
+ * @brief One case per point of the Cartesian product, the last axis changing
+ * fastest. Its directory holds the settings with the point applied.
+ * 
+ * @param settings 
+ */
+void SweepRunner::CreateCases(const YAML::Node& settings)
+{
+    size_t n_cases = 1;
+    for (const auto& axis : axes)
+    {
+        n_cases *= axis.values.size();
+    }
+
+    cases.resize(n_cases);
+
+    for (size_t i = 0; i < n_cases; i++)
+    {
+        Case& entry = cases[i];
+        entry.point.resize(axes.size());
+
+        size_t rest = i;
+        for (size_t a = axes.size(); a-- > 0;)
+        {
+            entry.point[a] = rest % axes[a].values.size();
+            rest /= axes[a].values.size();
+        }
+
+        entry.directory = (output_dir / ("case_" + std::to_string(i))).string();
+        std::filesystem::create_directories(entry.directory);
+
+        YAML::Node case_settings = YAML::Clone(settings);
+        for (size_t a = 0; a < axes.size(); a++)
+        {
+            SetSetting(case_settings, axes[a].path, 0, axes[a].values[entry.point[a]]);
+        }
+
+        std::ofstream ofile_handler(entry.directory + "/settings.yaml");
+        ofile_handler << case_settings;
+        ofile_handler.close();
+    }
+}
+
+/**
+ * @brief Runs the cases, starting a new one whenever a job ends.
+ * 
+ * @return true in the process of a case, with its output redirected to the
+ * case directory. Its working directory does not change, so the paths of the
+ * command file stay valid.
+ * @return false in the calling process, once every case ended and the summary
+ * is written.
+ */
+bool SweepRunner::Run()
+{
+    std::cout << "-- Sweep: " << cases.size() << " cases, " << n_jobs << " jobs" << std::endl;
+
+    size_t next = 0;
+    size_t running = 0;
+    size_t done = 0;
+
+    while (done < cases.size())
+    {
+        while (running < n_jobs && next < cases.size())
+        {
+            /* The child must not inherit pending output */
+            std::cout.flush();
+            std::fflush(nullptr);
+
+            pid_t pid = fork();
+            if (pid < 0)
+            {
+                std::string error_text = std::string(__FILE__) + ":"
+                                       + std::to_string(__LINE__) + ": "
+                                       + "ERROR [process could not be created]: case "
+                                       + std::to_string(next);
+                throw std::runtime_error(error_text);
+            }
+
+            if (pid == 0)
+            {
+                current = next;
+                Start(cases[next]);
+                return true;
+            }
+
+            cases[next].pid = pid;
+            next++;
+            running++;
+        }
+
+        int wait_status = 0;
+        pid_t pid = waitpid(-1, &wait_status, 0);
+        if (pid < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [wait failed]: errno "
+                                   + std::to_string(errno);
+            throw std::runtime_error(error_text);
+        }
+
+        for (size_t i = 0; i < next; i++)
+        {
+            if (cases[i].pid == pid)
+            {
+                Finish(cases[i], wait_status);
+                running--;
+                done++;
+
+                std::cout << "-- Case " << i << " (" << done << "/" << cases.size() << "): "
+                          << "status " << cases[i].status << ", " << cases[i].run_time << " s" << std::endl;
+                break;
+            }
+        }
+    }
+
+    WriteSummary();
+    return false;
+}
+
+/**
+ * @brief Redirects the output of a case process to stdout.txt and stderr.txt
+ * of its directory.
+ * 
+ * @param entry 
+ */
+void SweepRunner::Start(Case& entry)
+{
+    const char* names[2] = {"stdout.txt", "stderr.txt"};
+    const int outputs[2] = {STDOUT_FILENO, STDERR_FILENO};
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        std::string file_name = entry.directory + "/" + names[i];
+        int fd = open(file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0 || dup2(fd, outputs[i]) < 0)
+        {
+            std::string error_text = std::string(__FILE__) + ":"
+                                   + std::to_string(__LINE__) + ": "
+                                   + "ERROR [file could not be opened]: "
+                                   + file_name;
+            throw std::runtime_error(error_text);
+        }
+        close(fd);
+    }
+}
+
+/**
+ * @brief Exit status of a case, 128 + signal if it was killed, and the times
+ * of its time.txt in seconds.
+ * 
+ * @param entry 
+ * @param wait_status 
+ */
+void SweepRunner::Finish(Case& entry, int wait_status)
+{
+    entry.status = WIFEXITED(wait_status) ? WEXITSTATUS(wait_status) : 128 + WTERMSIG(wait_status);
+
+    std::ifstream time_file(entry.directory + "/time.txt");
+    char comma = 0;
+    double run_us = 0;
+    double loop_us = 0;
+    if (time_file >> run_us >> comma >> loop_us)
+    {
+        entry.run_time = run_us * 1e-6;
+        entry.loop_time = loop_us * 1e-6;
+    }
+}
+
+void SweepRunner::WriteSummary() const
+{
+    std::ofstream csv(output_dir / "summary.csv");
+    std::ofstream json(output_dir / "summary.json");
+
+    csv << "case";
+    for (const auto& axis : axes)
+    {
+        csv << ',' << axis.key;
+    }
+    csv << ",status,run_time,loop_time,directory\n";
+
+    json << "[\n";
+
+    for (size_t i = 0; i < cases.size(); i++)
+    {
+        const Case& entry = cases[i];
+
+        csv << i;
+        json << "  {\"case\": " << i << ", \"settings\": {";
+
+        for (size_t a = 0; a < axes.size(); a++)
+        {
+            const std::string& value = axes[a].values[entry.point[a]].Scalar();
+            csv << ',' << value;
+            json << ((a == 0) ? "" : ", ") << ToJson(axes[a].key) << ": " << ToJson(value);
+        }
+
+        csv << ',' << entry.status << ',' << entry.run_time << ',' << entry.loop_time << ',' << entry.directory << '\n';
+        json << "}, \"status\": " << entry.status << ", \"run_time\": " << entry.run_time
+             << ", \"loop_time\": " << entry.loop_time << ", \"directory\": " << ToJson(entry.directory)
+             << ((i + 1 == cases.size()) ? "}\n" : "},\n");
+    }
+
+    json << "]\n";
+}
+
+/**
+ * @brief JSON value of a scalar: numbers as they are, anything else quoted.
+ * 
+ * @param scalar 
+ * @return std::string 
+ */
+std::string SweepRunner::ToJson(const std::string& scalar)
+{
+    double number = 0;
+    auto [ptr, ec] = std::from_chars(scalar.data(), scalar.data() + scalar.size(), number);
+    bool is_number = !scalar.empty() && ec == std::errc() && ptr == scalar.data() + scalar.size()
+                     && std::isfinite(number) && std::isdigit(static_cast<unsigned char>(scalar.back()))
+                     && (std::isdigit(static_cast<unsigned char>(scalar.front())) || scalar.front() == '-');
+    if (is_number)
+    {
+        return scalar;
+    }
+
+    std::string text = "\"";
+    for (char c : scalar)
+    {
+        if (c == '"' || c == '\\')
+        {
+            text += '\\';
+        }
+        text += c;
+    }
+    return text + "\"";
+}
+
+/**
+ * @brief Settings of the case run by this process and their values.
+ * 
+ * @return std::vector<std::pair<std::string, std::string>> 
+ */
+/**
+ * @brief Directory of the case run by this process
+ * 
+ * @return const std::string& 
+ */
+const std::string& SweepRunner::GetDirectory() const
+{
+    return cases[current].directory;
+}
+
+std::vector<std::pair<std::string, std::string>> SweepRunner::GetOverrides() const
+{
+    std::vector<std::pair<std::string, std::string>> overrides;
+    for (size_t a = 0; a < axes.size(); a++)
+    {
+        overrides.emplace_back(axes[a].key, axes[a].values[cases[current].point[a]].Scalar());
+    }
+    return overrides;
+}
+
+size_t SweepRunner::GetCaseCount() const
+{
+    return cases.size();
+}
+
+size_t SweepRunner::GetFailedCount() const
+{
+    size_t failed = 0;
+    for (const auto& entry : cases)
+    {
+        failed += (entry.status != 0);
+    }
+    return failed;
+}
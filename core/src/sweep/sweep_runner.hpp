@@ -0,0 +1,129 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+#pragma once
+
+/*******************************************************************************
+* STANDARD HEADERS
+********************************************************************************/
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "yaml-cpp/yaml.h"
+
+/*******************************************************************************
+* SWEEP RUNNER CLASS
+********************************************************************************/
+
+/**
+ * @brief Runs the Cartesian product of the axes of a sweep file, one process
+ * per case and up to n_jobs at a time.
+ *
+ * @details Each top level key of the sweep file is a setting, like
+ * root.u_awgn_ch.ebno_db, and its value a list of values or ranges such as
+ * "0..20 step 2". Every case gets a directory with its settings.yaml, its logs
+ * and its output. The cases are handed out one at a time as the jobs finish,
+ * so long and short cases balance by themselves. At the end the status and
+ * times of every case go to summary.csv and summary.json.
+ *
+ * The cases are copies of the calling process, so they start from its state:
+ * a Simulator can run a common warm-up and apply GetOverrides() through its
+ * handlers once in the case.
+ */
+class SweepRunner
+{
+private:
+
+    /* Axes: setting path and its values */
+    struct Axis
+    {
+        std::string key;
+        std::vector<std::string> path;
+        std::vector<YAML::Node> values;
+    };
+
+    struct Case
+    {
+        std::vector<size_t> point;
+        std::string directory;
+        int pid { 0 };
+        int status { -1 };
+        double run_time { 0 };
+        double loop_time { 0 };
+    };
+
+    std::vector<Axis> axes;
+    std::vector<Case> cases;
+    size_t current { 0 };
+    std::filesystem::path output_dir;
+    size_t n_jobs { 1 };
+
+    /* Sweep file */
+    void LoadAxes(const std::string& sweep_file, const YAML::Node& settings);
+    static std::vector<YAML::Node> ParseValues(const std::string& key, const YAML::Node& node);
+    static void ParseRange(const std::string& key, const std::string& range, std::vector<YAML::Node>& values);
+    static bool HasSetting(const YAML::Node& settings, const std::vector<std::string>& path, size_t level);
+    static void SetSetting(YAML::Node settings, const std::vector<std::string>& path, size_t level,
+                           const YAML::Node& value);
+
+    /* Cases */
+    void CreateCases(const YAML::Node& settings);
+    void Start(Case& entry);
+    void Finish(Case& entry, int wait_status);
+    void WriteSummary() const;
+    static std::string ToJson(const std::string& scalar);
+
+public:
+
+    SweepRunner(const std::string& sweep_file, const std::string& settings_file,
+                const std::string& sweep_dir, size_t jobs);
+
+    bool Run();
+    const std::string& GetDirectory() const;
+    std::vector<std::pair<std::string, std::string>> GetOverrides() const;
+    size_t GetCaseCount() const;
+    size_t GetFailedCount() const;
+};
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* ██████████████████████████████████████████████████████████████████████████████
+* █▀▀▀▀███▀▀▀▀█████▀▀▀▀▀██████▀▀▀█████████▀▀▀▀▀▀▀███████▀▀▀▀▀▀▀█████▀▀▀▀████▀▀▀█
+* █    ███    ████▌      ████▌   ████████    ▄▄    ███▀   ▄▄▄   ▀███     ▀██   █
+* █    ▀▀▀    ████   ▄   ▐███▌   ███████    ████▄▄▄██▌   ▐███▌   ▐██       ▀   █
+* █           ███   ▐█▌   ███▌   ███████    █████████▌   ▐███▌    ██   ▄       █
+* █    ███    ██▌          ██▌   ███████▄   ▀██▀   ▐██    ███    ███   ██▄     █
+* █    ███    ██   █████   ██▌        ████▄      ▄█████▄       ▄████   ████▄   █
+* ██████████████████████████████████████████████████████████████████████████████
+* █████████████████████████ DSP SIMULATION ENGINE ██████████████████████████████
+* ▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀▀
+********************************************************************************
+* Author: Patricio Reus Merlo
+* Date: 10/17/2026
+********************************************************************************
+* MIT License
+* 
+* Copyright (c) 2024 Fundacion Fulgor
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+********************************************************************************/
+
+/*******************************************************************************
+* LOCAL HEADERS
+********************************************************************************/
+
+#include "thread_pool.hpp"
+
+/*******************************************************************************
+* THREAD POOL CLASS
+********************************************************************************/
+
+ThreadPool::~ThreadPool()
+{
+    stop.store(true);
+    generation.fetch_add(1, std::memory_order_release);
+    generation.notify_all();
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Start the workers. The calling thread counts as one of the
+ * n_threads, so n_threads <= 1 keeps everything on the calling thread.
+ * 
+ * @param n_threads 
+ */
+void ThreadPool::Init(size_t n_threads)
+{
+    for (size_t i {1}; i < n_threads; i++)
+    {
+        workers.emplace_back(&ThreadPool::Worker, this);
+    }
+}
+
+/**
+ * @brief Run the masters of the modules and wait for all of them.
+ * 
+ * @param modules 
+ * @param n_modules 
+ */
+void ThreadPool::Run(Module* const* modules, size_t n_modules)
+{
+    /* Workers are parked: the batch can be written */
+    batch = modules;
+    batch_size = n_modules;
+    next_index.store(0, std::memory_order_relaxed);
+    n_finished.store(0, std::memory_order_relaxed);
+
+    generation.fetch_add(1, std::memory_order_release);
+    generation.notify_all();
+
+    Work();
+
+    /* Barrier */
+    while (n_finished.load(std::memory_order_acquire) != workers.size())
+    {
+        std::this_thread::yield();
+    }
+}
+
+size_t ThreadPool::GetThreadCount() const
+{
+    return workers.size() + 1;
+}
+
+void ThreadPool::Worker()
+{
+    unsigned long seen { 0 };
+
+    while (true)
+    {
+        /* Spin briefly, then sleep until the next batch */
+        for (unsigned int i {0}; i < SPIN_COUNT && generation.load(std::memory_order_acquire) == seen; i++)
+        {
+            std::this_thread::yield();
+        }
+
+        generation.wait(seen, std::memory_order_acquire);
+        seen = generation.load(std::memory_order_acquire);
+
+        if (stop.load())
+        {
+            return;
+        }
+
+        Work();
+        n_finished.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void ThreadPool::Work()
+{
+    size_t index;
+
+    while ((index = next_index.fetch_add(1, std::memory_order_relaxed)) < batch_size)
+    {
+        batch[index]->RunClockMaster();
+    }
+}
@@ -49,7 +49,7 @@ private:
 
     /* Registers */
     Register<std::complex<double>> r_out;
-    Register<double, N - 1> r_shift_reg;
+    DelayLine<double, N - 1> r_shift_reg;
     Register<double> r_int;
 
     /* Settings YAML */
@@ -113,16 +113,14 @@ void AGC<N>::RunClockMaster()
     
     double signal_power = pow(r_out.i.real(), 2) + pow(r_out.i.imag(), 2);
 
-    for (size_t i {N - 2}; i > 0; i--)
-    {
-        r_shift_reg.i[i] = r_shift_reg.o[i - 1];
-    }
-    r_shift_reg.i[0] = signal_power;
+    r_shift_reg.Push(signal_power);
+
+    const double* powers = r_shift_reg.o.data();
 
     double average_power = signal_power / N;
     for (size_t i { 0 }; i < (N - 1); i++)
     {
-        average_power += r_shift_reg.o[i] / N;
+        average_power += powers[i] / N;
     }
     
     r_int.i = r_int.o + step * (reference_power - average_power);
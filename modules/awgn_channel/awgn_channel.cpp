@@ -83,14 +83,25 @@ void AWGNChannel::Init()
     p_noise = p_tx / snr_lin;
 
     /* Random Generator */
-    normal_dist = std::normal_distribution<double>(0, 1);
-    rng = std::mt19937(seed);
+    rng.Init(seed, GetFullName());
+}
+
+bool AWGNChannel::Reconfigure()
+{
+    /* Noise Power */
+    snr_lin = pow(10, ebno_db / 10) * log2(m_qam) / static_cast<double>(n_ovr);
+    p_noise = p_tx / snr_lin;
+
+    /* Random Generator */
+    rng.Init(seed, GetFullName());
+    return true;
 }
 
 void AWGNChannel::RunClockMaster()
 {
-    double noise_i = sqrt(p_noise / 2) * normal_dist(rng);
-    double noise_q = sqrt(p_noise / 2) * normal_dist(rng);
+    double noise[2];
+    rng.Gaussian(i_clock->GetTickCount(), noise, 2);
 
-    r_out.i = std::complex<double>(noise_i, noise_q) + i_signal.GetData();
+    double sigma = sqrt(p_noise / 2);
+    r_out.i = std::complex<double>(sigma * noise[0], sigma * noise[1]) + i_signal.GetData();
 }
\ No newline at end of file
@@ -39,7 +39,6 @@
 #pragma once
 
 #include <complex>
-#include <random>
 
 #include "halcon.hpp"
 
@@ -51,8 +50,7 @@ private:
     Register<std::complex<double>> r_out;
 
     /* Noise */
-    std::normal_distribution<double> normal_dist;
-    std::mt19937 rng;
+    RandomStream rng;
 
     /* Variables */
     size_t n_ovr;
@@ -71,6 +69,7 @@ public:
 
     /* Behavior */
     void Init() override;
+    bool Reconfigure() override;
     void Connect() override;
     void RunClockMaster() override;
 
@@ -54,7 +54,7 @@ private:
     Register<size_t> r_n_bits { 0 };
     Register<size_t> r_n_errors { 0 };
     Register<double> r_ber_value { 0 };
-    Register<std::complex<double>, 100> r_delay_comp;
+    DelayLine<std::complex<double>, 100> r_delay_comp;
 
     /* Variables */
     size_t m_qam { 4 };
@@ -82,6 +82,7 @@ public:
 
     /* User methods */
     void Init() override;
+    bool Reconfigure() override;
     void Connect() override;
     void RunClockMaster() override;
 
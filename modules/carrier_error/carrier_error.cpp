@@ -60,6 +60,12 @@ void CarrierError::Init()
     /* Pass */
 }
 
+bool CarrierError::Reconfigure()
+{
+    /* The settings are read at each edge */
+    return true;
+}
+
 void CarrierError::Connect()
 {
     /* Register on clock positive edge */
@@ -66,6 +66,7 @@ public:
 
     /* User methods */
     void Init() override;
+    bool Reconfigure() override;
     void Connect() override;
     void RunClockMaster() override;
 
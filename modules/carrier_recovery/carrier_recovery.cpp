@@ -67,6 +67,12 @@ void CarrierRecovery::Init()
     /* Pass */
 }
 
+bool CarrierRecovery::Reconfigure()
+{
+    /* The settings are read at each edge */
+    return true;
+}
+
 void CarrierRecovery::Connect()
 {
     /* Register on clock positive edge */
@@ -48,8 +48,8 @@ class CycleSlipCorrector : public Module
 private:
 
     /* Registers */
-    Register<std::complex<double>, N> r_symb_ref;
-    Register<std::complex<double>, N> r_symb_hat;
+    DelayLine<std::complex<double>, N> r_symb_ref;
+    DelayLine<std::complex<double>, N> r_symb_hat;
     Register<std::complex<double>> r_out;
 
     /* Variables */
@@ -122,13 +122,8 @@ void CycleSlipCorrector<N>::RunClockMaster()
     if (enable)
     {
         /* Shift Registers */
-        for (size_t i = (N - 1); i > 0; i--)
-        {
-            r_symb_ref.i[i] = r_symb_ref.o[i - 1];
-            r_symb_hat.i[i] = r_symb_hat.o[i - 1];
-        }
-        r_symb_ref.i[0] = i_symb_ref.GetData();
-        r_symb_hat.i[0] = i_symb_hat.GetData();
+        r_symb_ref.Push(i_symb_ref.GetData());
+        r_symb_hat.Push(i_symb_hat.GetData());
 
         /* Correlation */
         m11 = i_symb_ref.GetData().real() * i_symb_hat.GetData().real();
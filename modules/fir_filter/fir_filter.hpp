@@ -48,7 +48,7 @@ class FIRFilter : public Module
 private:
 
     /* Registers */
-    Register<std::complex<double>, (N - 1)> r_shift_reg;
+    DelayLine<std::complex<double>, (N - 1)> r_shift_reg;
     Register<std::complex<double>> r_out;
 
     /* Variables */
@@ -107,16 +107,14 @@ void FIRFilter<T, N>::Init()
 template <typename T, size_t N>
 void FIRFilter<T, N>::RunClockMaster()
 {
-    for (size_t i { N - 2 }; i > 0; i--)
-    {
-        r_shift_reg.i[i] = r_shift_reg.o[i - 1];
-    }
-    r_shift_reg.i[0] = i_signal.GetData();
+    r_shift_reg.Push(i_signal.GetData());
+
+    const std::complex<double>* samples = r_shift_reg.o.data();
 
     result = i_signal.GetData() * coeffs[0];
     for (size_t i { 0 }; i < (N - 1); i++)
     {
-        result += r_shift_reg.o[i] * coeffs[i + 1];
+        result += samples[i] * coeffs[i + 1];
     }
 
     r_out.i = result;
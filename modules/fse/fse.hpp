@@ -48,7 +48,7 @@ class FractionallySpacedEqualizer : public Module
 private:
 
     /* Registers */
-    Register<std::complex<double>, (N - 1)> r_shift_reg;
+    DelayLine<std::complex<double>, (N - 1)> r_shift_reg;
     Register<std::complex<double>> r_out;
 
     /* Variables */
@@ -104,16 +104,14 @@ void FractionallySpacedEqualizer<N>::Connect()
 template <size_t N>
 void FractionallySpacedEqualizer<N>::RunClockMaster()
 {
-    for (size_t i = (N - 2); i > 0; i--)
-    {
-        r_shift_reg.i[i] = r_shift_reg.o[i - 1];
-    }
-    r_shift_reg.i[0] = i_signal.GetData();
+    r_shift_reg.Push(i_signal.GetData());
+
+    const std::complex<double>* samples = r_shift_reg.o.data();
 
     result = i_signal.GetData() * i_coeffs[0].GetData();
     for (size_t i = 0; i < (N - 1); i++)
     {
-        result += r_shift_reg.o[i] * i_coeffs[i + 1].GetData();
+        result += samples[i] * i_coeffs[i + 1].GetData();
     }
 
     r_out.i = result;
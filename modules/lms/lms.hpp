@@ -49,7 +49,7 @@ class LMS : public Module
 private:
 
     /* Registers */
-    Register<std::complex<double>, (N - 1)> r_shift_reg { 0 };
+    DelayLine<std::complex<double>, (N - 1)> r_shift_reg { 0 };
     Register<std::complex<double>, N> r_out { 0 };
 
     /* Variables */
@@ -120,11 +120,7 @@ void LMS<N>::Connect()
 template <size_t N>
 void LMS<N>::RunClockMaster()
 {
-    for (size_t i = (N - 2); i > 0; i--)
-    {
-        r_shift_reg.i[i] = r_shift_reg.o[i - 1];
-    }
-    r_shift_reg.i[0] = i_signal.GetData();
+    r_shift_reg.Push(i_signal.GetData());
 
     for (size_t i = 0; i < N; i++)
     {
@@ -60,6 +60,12 @@ void SinGenerator::Init()
     /* Pass */
 }
 
+bool SinGenerator::Reconfigure()
+{
+    /* The settings are read at each edge */
+    return true;
+}
+
 void SinGenerator::Connect()
 {
     /* Register the module into the clock as positive edge sensitive */
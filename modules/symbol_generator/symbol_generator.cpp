@@ -98,8 +98,14 @@ void SymbolGenerator::Init()
     k_qam = static_cast<int>(sqrt(m_qam));
 
     /* Random Generator */
-    uniform_dist = std::uniform_int_distribution<int>(0, (k_qam - 1));
-    rng = std::mt19937(seed);
+    rng.Init(static_cast<uint64_t>(seed), GetFullName());
+}
+
+bool SymbolGenerator::Reconfigure()
+{
+    /* Random Generator */
+    rng.Init(static_cast<uint64_t>(seed), GetFullName());
+    return true;
 }
 
 /*******************************************************************************
@@ -108,8 +114,11 @@ void SymbolGenerator::Init()
 
 void SymbolGenerator::RunClockMaster()
 {
-    int symb_i_aux = 2 * uniform_dist(rng) - (k_qam - 1);
-    int symb_q_aux = 2 * uniform_dist(rng) - (k_qam - 1);
+    uint32_t symbols[2];
+    rng.Integer(i_clock->GetTickCount(), static_cast<uint32_t>(k_qam), symbols, 2);
+
+    int symb_i_aux = 2 * static_cast<int>(symbols[0]) - (k_qam - 1);
+    int symb_q_aux = 2 * static_cast<int>(symbols[1]) - (k_qam - 1);
 
     r_symb_ref.i = std::complex<double>(symb_i_aux, symb_q_aux);
     r_symb_tx.i = std::complex<double>(symb_i_aux, symb_q_aux) * sqrt(p_tx / p_qam);
@@ -43,7 +43,6 @@
 ********************************************************************************/
 
 #include <complex>
-#include <random>
 #include "halcon.hpp"
 
 /*******************************************************************************
@@ -59,8 +58,7 @@ private:
     Register<std::complex<double>> r_symb_ref;
 
     /* Random Generator */
-    std::uniform_int_distribution<int> uniform_dist;
-    std::mt19937 rng;
+    RandomStream rng;
 
     /* Variables */
     double p_qam;
@@ -78,6 +76,7 @@ public:
 
     /* User methods */
     void Init() override;
+    bool Reconfigure() override;
     void Connect() override;
     void RunClockMaster() override;
     
@@ -64,6 +64,12 @@ void Template::Init()
     /* pass */
 }
 
+bool Template::Reconfigure()
+{
+    /* The settings are read at each edge */
+    return true;
+}
+
 void Template::Connect()
 {
     /* Registers to Clock */
@@ -59,6 +59,7 @@ public:
 
     /* Behavior */
     void Init() override;
+    bool Reconfigure() override;
     void Connect() override;
     void RunClockMaster() override;
 
@@ -70,6 +70,12 @@ void TimingRecovery::Init()
     /* pass */
 }
 
+bool TimingRecovery::Reconfigure()
+{
+    /* The settings are read at each edge */
+    return true;
+}
+
 void TimingRecovery::Connect()
 {
     i_clock_os->RegisterOnPositiveEdge(this, r_offset);
@@ -90,11 +96,7 @@ void TimingRecovery::Connect()
 void TimingRecovery::RunClockMaster()
 {
     // TED
-    for (size_t i = NOS - 1; i > 0; i--)
-    {
-        r_signal.i[i] = r_signal.o[i - 1];
-    }
-    r_signal.i[0] = i_signal.GetData();
+    r_signal.Push(i_signal.GetData());
 
     timing_error = std::complex<double>(r_signal.o[1].real() * (r_signal.o[3].real() - i_signal.GetData().real()) +
                                         r_signal.o[1].imag() * (r_signal.o[3].imag() - i_signal.GetData().imag()), 0);
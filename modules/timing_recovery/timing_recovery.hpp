@@ -55,7 +55,7 @@ private:
     Register<double> r_offset;
     Register<int> r_base_pointer;
 
-    Register<std::complex<double>, NOS> r_signal;
+    DelayLine<std::complex<double>, NOS> r_signal;
 
     /* Variables */
     double prop_error;
@@ -78,6 +78,7 @@ public:
 
     /* Behavior */
     void Init() override;
+    bool Reconfigure() override;
     void Connect() override;
     void RunClockMaster() override;
     
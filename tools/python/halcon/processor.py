@@ -46,7 +46,9 @@ import numpy as np
 import os
 import pickle
 import re
+import struct
 import tabulate
+import yaml
 
 ################################################################################
 # HALCON MODULES
@@ -87,6 +89,15 @@ class Processor:
     LOG_KEY = 'LOG'
     FLOG_KEY = 'FLOG'
 
+    CONTAINER_EXTENSION = '.hlc'
+    CONTAINER_MAGIC = b'HALCONLC'
+    CONTAINER_INDEX_TYPE = np.dtype([('signal', np.uint32), ('reserved', np.uint32),
+                                     ('offset', np.uint64), ('samples', np.uint64)])
+    CONTAINER_LAST_TICK = np.iinfo(np.uint64).max
+
+    WAVEFORM_EXTENSION = '.vcd'
+    WAVEFORM_SECONDS = {'s': 1.0, 'ms': 1e-3, 'us': 1e-6, 'ns': 1e-9, 'ps': 1e-12, 'fs': 1e-15}
+
     SIGNAL_KEY = '_SIGNAL_'
     CLOCK_KEY = '_CLOCK_'
     BEGIN_KEY = '_BEGIN_'
@@ -150,7 +161,7 @@ class Processor:
         return Processor.load_files(files)
 
     @classmethod
-    def load_files(cls, files):
+    def load_files(cls, files, patterns="*"):
         files = sorted(files)
         results = {}
         
@@ -159,6 +170,18 @@ class Processor:
             # File information
             file_name, file_type = os.path.splitext(os.path.basename(file))
             
+            # Container of the run: signals are selected by name
+            if file_type == Processor.CONTAINER_EXTENSION:
+                for signal, data in Processor.load_container(file, patterns).items():
+                    Processor.__add_result(results, signal, data)
+                continue
+
+            # Waveform of the run: only the value changes
+            if file_type == Processor.WAVEFORM_EXTENSION:
+                for signal, data in Processor.load_waveform(file, patterns).items():
+                    Processor.__add_result(results, signal, data)
+                continue
+
             if file_name.startswith(Processor.LOG_KEY):
                 signal = Processor.LOG_SIGNAL_PATTERN.search(file_name).group(1)
                 clock = Processor.LOG_CLOCK_PATTERN.search(file_name).group(1)
@@ -213,14 +236,194 @@ class Processor:
                 data['b'] = begin
                 data['e'] = end
             
-            if signal in results.keys():
-                if not isinstance(results[signal], np.ndarray):
-                    results[signal] = np.array(results[signal], dtype=object)
-                results[signal] = np.append(results[signal], data)
+            Processor.__add_result(results, signal, data)
+        return results
+
+    @classmethod
+    def load_container(cls, file, patterns="*"):
+        """Signals of a log container whose names match the patterns. The file is
+        memory mapped: only the chunks of the selected signals are read, and a
+        signal stored in a single chunk is not even copied."""
+        if not isinstance(patterns, list):
+            patterns = [patterns]
+
+        with open(file, 'rb') as bin_file:
+
+            # Header
+            magic, version, n_signals = struct.unpack('=8sII', bin_file.read(16))
+            if magic != Processor.CONTAINER_MAGIC:
+                raise TypeError(f"{file} is not a log container.")
+            if version != 1:
+                raise TypeError(f"Log container version {version} of {file} is not supported.")
+
+            # Signal catalogue
+            def read_string():
+                length, = struct.unpack('=I', bin_file.read(4))
+                return bin_file.read(length).decode()
+
+            catalogue = []
+            for _ in range(n_signals):
+                name = read_string()
+                clock = read_string()
+                type = read_string()
+                bytes, size, edge, begin, step, end = struct.unpack('=IIcQQQ', bin_file.read(33))
+                catalogue.append((name, clock, type, str(bytes), size, begin, end))
+
+            # Trailer and index
+            bin_file.seek(-24, os.SEEK_END)
+            index_offset, n_chunks, magic = struct.unpack('=QQ8s', bin_file.read(24))
+            if magic != Processor.CONTAINER_MAGIC:
+                raise TypeError(f"{file} has no index, the simulation did not finish.")
+
+        content = np.memmap(file, dtype=np.uint8, mode='r')
+        index = content[index_offset:index_offset + n_chunks * Processor.CONTAINER_INDEX_TYPE.itemsize]
+        index = index.view(Processor.CONTAINER_INDEX_TYPE)
+
+        results = {}
+        for signal_index, (signal, clock, type, bytes, size, begin, end) in enumerate(catalogue):
+
+            if not any(fnmatch.fnmatchcase(signal, pattern) for pattern in patterns):
+                continue
+
+            # Data type
+            if type in Processor.NUMPY_TYPE_MAP \
+                and bytes in Processor.NUMPY_TYPE_MAP[type]:
+                
+                np_type = Processor.NUMPY_TYPE_MAP[type][bytes]
             else:
-                results[signal] = data
+                raise TypeError(f"{type} type of {bytes} bytes is not supported.")
+
+            # Chunks of the signal, views of the mapped file
+            chunks = []
+            for chunk in index[index['signal'] == signal_index]:
+                first = int(chunk['offset'])
+                last = first + int(chunk['samples']) * int(bytes) * size
+                chunks.append(content[first:last].view(np_type))
+
+            if len(chunks) == 0:
+                samples = np.empty(0, dtype=np_type)
+            elif len(chunks) == 1:
+                samples = chunks[0]
+            else:
+                samples = np.concatenate(chunks)
+
+            # Matrix conversion
+            if size != 1:
+                samples = samples.reshape(-1, size)
+
+            data = dict()
+            data['s'] = samples
+            data['f'] = Processor.CONTAINER_EXTENSION
+            data['c'] = clock
+            data['b'] = str(begin)
+            data['e'] = 'last' if end == Processor.CONTAINER_LAST_TICK else str(end)
+            results[signal] = data
+        return results
+
+    @classmethod
+    def load_waveform(cls, file, patterns="*"):
+        """Variables of a VCD waveform whose names match the patterns. Each one
+        has the values after each change, 's', and the times of the changes in
+        seconds, 't'. Bit vectors are unsigned integers of 'w' bits, fixed point
+        values included, and reals have 'w' 0. Array elements and complex parts
+        are variables of their own: name_<element>, name_re and name_im."""
+        if not isinstance(patterns, list):
+            patterns = [patterns]
+
+        with open(file, 'r') as vcd_file:
+            text = vcd_file.read()
+
+        header, _, body = text.partition('$enddefinitions')
+        tokens = header.split()
+
+        # Variables and their scopes
+        scale = 1.0
+        scopes = []
+        variables = {}
+        i = 0
+        while i < len(tokens):
+            if tokens[i] == '$timescale':
+                unit = ''.join(tokens[i + 1:tokens.index('$end', i)])
+                number = unit.rstrip('munpfs')
+                scale = float(number) * Processor.WAVEFORM_SECONDS[unit[len(number):]]
+            elif tokens[i] == '$scope':
+                scopes.append(tokens[i + 2])
+            elif tokens[i] == '$upscope':
+                scopes.pop()
+            elif tokens[i] == '$var':
+                kind, width, identifier, name = tokens[i + 1:i + 5]
+                name = '.'.join(scopes + [name])
+                if any(fnmatch.fnmatchcase(name, pattern) for pattern in patterns):
+                    width = 0 if kind == 'real' else int(width)
+                    variables[identifier] = (name, width, [], [])
+            i += 1
+
+        # Changes
+        time = 0
+        for line in body.split('\n')[1:]:
+            if not line:
+                continue
+            if line[0] == '#':
+                time = int(line[1:])
+            elif line[0] in 'br':
+                value, identifier = line[1:].split()
+                if identifier in variables:
+                    variables[identifier][2].append(time)
+                    variables[identifier][3].append(float(value) if line[0] == 'r' else int(value, 2))
+            elif line[0] in '01' and line[1:] in variables:
+                variables[line[1:]][2].append(time)
+                variables[line[1:]][3].append(int(line[0]))
+
+        results = {}
+        for name, width, times, values in variables.values():
+            data = dict()
+            data['s'] = np.array(values, dtype=np.float64 if width == 0 else np.uint64)
+            data['t'] = np.array(times, dtype=np.float64) * scale
+            data['w'] = width
+            data['f'] = Processor.WAVEFORM_EXTENSION
+            results[name] = data
         return results
 
+    @classmethod
+    def load_capture(cls, file):
+        """Windows of a CAPTURE command from its yaml index file. Each window is
+        the index entry plus its samples, 's', read from the data file."""
+        with open(file, 'r') as index_file:
+            index = yaml.safe_load(index_file)
+
+        type = index['type']
+        bytes = str(index['bytes'])
+        size = int(index['size'])
+
+        if type in Processor.NUMPY_TYPE_MAP \
+            and bytes in Processor.NUMPY_TYPE_MAP[type]:
+
+            np_type = Processor.NUMPY_TYPE_MAP[type][bytes]
+        else:
+            raise TypeError(f"{type} type of {bytes} bytes is not supported.")
+
+        data_file = os.path.join(os.path.dirname(file), index['data'])
+        content = np.fromfile(data_file, dtype=np_type)
+
+        if size != 1:
+            content = content.reshape(-1, size)
+
+        windows = []
+        for window in index['windows']:
+            window = dict(window)
+            window['s'] = content[window['offset']:window['offset'] + window['samples']]
+            windows.append(window)
+        return windows
+
+    @staticmethod
+    def __add_result(results, signal, data):
+        if signal in results.keys():
+            if not isinstance(results[signal], np.ndarray):
+                results[signal] = np.array(results[signal], dtype=object)
+            results[signal] = np.append(results[signal], data)
+        else:
+            results[signal] = data
+
     ############################################################################
     # SETTERS AND GETTERS
     ############################################################################
@@ -314,7 +517,10 @@ class Processor:
                 return p.value
         raise ValueError(f"Unknown parameter: {param_name}")
     
-    def signals(self, patterns="*"):
+    def signals(self, patterns="*", names="*"):
+        """Signals of every case. The patterns select the log files, and the
+        names select the signals of the log container and the waveform, which
+        hold every signal of the run."""
         if not isinstance(patterns, list):
             patterns = [patterns]
         
@@ -334,6 +540,8 @@ class Processor:
             files = []
             for pattern in patterns:    
                 files.extend(glob.glob(os.path.join(case.logs_directory, pattern)))
+            files.extend(glob.glob(os.path.join(case.logs_directory, '*' + Processor.CONTAINER_EXTENSION)))
+            files.extend(glob.glob(os.path.join(case.logs_directory, '*' + Processor.WAVEFORM_EXTENSION)))
             index = tuple([indices[case_i, i] for i in range(n_params)])
-            results[index] = self.load_files(files)
+            results[index] = self.load_files(sorted(set(files)), names)
         return results
\ No newline at end of file
@@ -80,6 +80,9 @@ class SimulatorHandler:
     # File type
     __TEXT = "t"
     __BINARY = "b"
+    __MAPPED = "m"
+    __CONTAINER = "c"
+    __WAVEFORM = "v"
 
     # File name type
     __LONG = "l"
@@ -185,11 +188,14 @@ class SimulatorHandler:
         # HALCON: commands
         self.__halcon_log_cmd = 'LOG -s {signal} -c {clock} -e {edge} -b {begin} -p {step} -d {end} -t {file_t} -n {file_n} -f {format}'
         self.__halcon_flog_cmd = 'FLOG -s {signal} -t {file_t} -n {file_n} -f {format}'
+        self.__halcon_capture_cmd = 'CAPTURE -s {signal} -c {clock} -e {edge} -b {begin} -p {step} -d {end} -g {trigger} -i {index} -m {mode} -l {level} -r {pre} -o {post} -x {windows} -n {file_n}'
+        self.__halcon_stat_cmd = 'STAT -s {signal} -c {clock} -e {edge} -b {begin} -p {step} -d {end} -k {kinds} -w {window} -n {file_n}'
         self.__halcon_setv_cmd = 'SET -v "{value}" -s {signal} -c {clock} -e {edge} -b {begin} -d {end}'
         self.__halcon_setf_cmd = 'SET -f "{file}" -s {signal} -c {clock} -e {edge} -b {begin} -d {end}'
+        self.__halcon_setw_cmd = 'SET -w "{file}"{loop} -s {signal} -c {clock} -e {edge} -b {begin} -d {end}'
         
         self.__halcon_valid_edge = ["p", "n", "b"]
-        self.__halcon_valid_file_t = ["t", "b"]
+        self.__halcon_valid_file_t = ["t", "b", "m", "c", "v"]
         self.__halcon_valid_file_n = ["l", "s"]
         self.__halcon_valid_format = ["0", "d", "i", "h"]
         
@@ -724,6 +730,97 @@ class SimulatorHandler:
         )
         self.__write_to_command_file(command)
 
+    def add_stat(self, signals, clock, edge="p", begin=0, step=1, end=0,
+                        kinds="mean,var,min,max", window=0, file_name_type="l"):
+
+        # Support to list of signals or an individual signal
+        if not isinstance(signals, list):
+            signals = [signals]
+
+        # Support to list of statistics
+        if isinstance(kinds, list):
+            kinds = ",".join(kinds)
+
+        # Update hierarchy
+        if not self.__is_hierarchy_available:
+            self.__load_hierarchy()
+
+        # Check stat command fields
+        self.check_if_exists_in_hierarchy(clock)
+        self.__check_if_edge_is_valid(edge)
+        self.__check_if_linspace_is_valid(begin, step, end)
+        self.__check_if_file_name_type_is_valid(file_name_type)
+        if window < 0:
+            raise ValueError(f"The window must be a non-negative number of samples.")
+
+        for signal in signals:
+
+            # Check signal
+            self.check_if_exists_in_hierarchy(signal)
+            self.__check_if_it_is_loggeable(signal)
+
+            # Build command
+            command = self.__halcon_stat_cmd.format(
+                signal=signal,
+                clock=clock,
+                edge=edge,
+                begin=begin,
+                step=step,
+                end=end,
+                kinds=kinds,
+                window=window,
+                file_n=file_name_type
+            )
+            self.__write_to_command_file(command)
+
+    def add_capture(self, signals, clock, trigger, mode="r", level=0.5, pre=1000, post=1000,
+                           windows=1, index=0, edge="p", begin=0, step=1, end=0, file_name_type="l"):
+
+        # Support to list of signals or an individual signal
+        if not isinstance(signals, list):
+            signals = [signals]
+
+        # Update hierarchy
+        if not self.__is_hierarchy_available:
+            self.__load_hierarchy()
+
+        # Check capture command fields
+        self.check_if_exists_in_hierarchy(clock)
+        self.check_if_exists_in_hierarchy(trigger)
+        self.__check_if_it_is_loggeable(trigger)
+        self.__check_if_edge_is_valid(edge)
+        self.__check_if_linspace_is_valid(begin, step, end)
+        self.__check_if_file_name_type_is_valid(file_name_type)
+        if mode not in ["r", "f", "x", "c", "h", "l"]:
+            raise ValueError(f"The trigger mode must be one of r, f, x, c, h or l.")
+        if pre < 0 or post < 1 or windows < 0 or index < 0:
+            raise ValueError(f"The capture needs pre >= 0, post >= 1, windows >= 0 and index >= 0.")
+
+        for signal in signals:
+
+            # Check signal
+            self.check_if_exists_in_hierarchy(signal)
+            self.__check_if_it_is_loggeable(signal)
+
+            # Build command
+            command = self.__halcon_capture_cmd.format(
+                signal=signal,
+                clock=clock,
+                edge=edge,
+                begin=begin,
+                step=step,
+                end=end,
+                trigger=trigger,
+                index=index,
+                mode=mode,
+                level=level,
+                pre=pre,
+                post=post,
+                windows=windows,
+                file_n=file_name_type
+            )
+            self.__write_to_command_file(command)
+
     def add_setv(self, value, signal, clock, edge="p", begin=0, end=0):
 
         # Check log command fields
@@ -766,6 +863,29 @@ class SimulatorHandler:
         )
         self.__write_to_command_file(command)
 
+    def add_setw(self, file, signal, clock, edge="p", begin=0, end=0, loop=False):
+        file_abs_path = os.path.join(self.project_abs_dir, file)
+
+        # Check set command fields
+        self.check_if_exists_in_hierarchy(signal)
+        self.check_if_exists_in_hierarchy(clock)
+        self.__check_if_it_is_setteable(signal)
+        self.__check_if_edge_is_valid(edge)
+        self.__check_if_linspace_is_valid(begin, 1, end)
+        self.__check_file_existence(file_abs_path)
+
+        # Build command
+        command = self.__halcon_setw_cmd.format(
+            file=file_abs_path,
+            loop=" -l" if loop else "",
+            signal=signal,
+            clock=clock,
+            edge=edge,
+            begin=begin,
+            end=end
+        )
+        self.__write_to_command_file(command)
+
     @keep_directory
     def get_available_external_modules(self):
         if self.modules_dir == None: